@@ -0,0 +1,85 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+#include <fmt/format.h>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
+#include <trading/io/compressed_ifstream.hpp>
+#include <trading/io/csv/reader.hpp>
+
+using namespace trading;
+
+template<class Compressor>
+void write_compressed(const std::filesystem::path& path, const std::string& content)
+{
+    std::ofstream file{path, std::ios::binary};
+    boost::iostreams::filtering_ostream out;
+    out.push(Compressor{});
+    out.push(file);
+    out << content;
+}
+
+// candle rows of a random walk in the format of the input data
+std::string random_rows(std::size_t count, std::mt19937& gen)
+{
+    std::normal_distribution<double> step{0.0, 0.002};
+    std::string content;
+    double price{100.0};
+
+    for (std::size_t i{0}; i<count; i++) {
+        price *= std::exp(step(gen));
+        content += fmt::format("{}|{:.4f}|{:.4f}|{:.4f}|{:.4f}\n", 1'600'000'000+i*60, price, price*1.001,
+                price*0.999, price);
+    }
+    return content;
+}
+
+template<class FileStream>
+void measure(const std::string& name, const std::filesystem::path& path)
+{
+    auto begin = std::chrono::steady_clock::now();
+    io::csv::reader<5, FileStream> reader{path, '|'};
+    std::time_t opened;
+    double open, high, low, close, checksum{0.0};
+    std::size_t count{0};
+    while (reader.read_row(opened, open, high, low, close)) {
+        checksum += close;
+        count++;
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()-begin);
+    std::cout << fmt::format("{:<34} rows: {:>8}, size: {:>10} B, duration: {:>6} ms, checksum: {:.2f}", name,
+            count, std::filesystem::file_size(path), duration.count(), checksum) << std::endl;
+}
+
+// reads the same candles from a plain, gzip and zstd compressed file
+int main()
+{
+    std::mt19937 gen{42};
+    auto content = random_rows(3'000'000, gen);
+    auto dir = std::filesystem::temp_directory_path();
+    std::filesystem::path plain{dir/"compressed_ifstream_benchmark.csv"};
+    std::filesystem::path gzip{dir/"compressed_ifstream_benchmark.csv.gz"};
+    std::filesystem::path zstd{dir/"compressed_ifstream_benchmark.csv.zst"};
+    std::ofstream{plain, std::ios::binary} << content;
+    write_compressed<boost::iostreams::gzip_compressor>(gzip, content);
+    write_compressed<boost::iostreams::zstd_compressor>(zstd, content);
+
+    for (std::size_t rep{0}; rep<3; rep++) {
+        measure<std::ifstream>("std::ifstream, plain", plain);
+        measure<io::compressed_ifstream>("io::compressed_ifstream, plain", plain);
+        measure<io::compressed_ifstream>("io::compressed_ifstream, gzip", gzip);
+        measure<io::compressed_ifstream>("io::compressed_ifstream, zstd", zstd);
+    }
+
+    for (const auto& path: {plain, gzip, zstd})
+        std::filesystem::remove(path);
+    return EXIT_SUCCESS;
+}
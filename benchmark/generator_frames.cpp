@@ -0,0 +1,89 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <fmt/format.h>
+#include <etl/vector.h>
+#include <cppcoro/generator.hpp>
+#include <trading/systematic/generators.hpp>
+#include <trading/bazooka/configuration.hpp>
+#include <trading/bazooka/search_space.hpp>
+
+using namespace trading;
+constexpr std::size_t n_levels{3};
+using config_t = bazooka::configuration<n_levels>;
+
+// counts the allocations that reach the global allocator
+std::atomic<std::size_t> allocation_count{0};
+
+void* operator new(std::size_t size)
+{
+    allocation_count++;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+template<class Enumerate>
+void measure(const std::string& name, Enumerate&& enumerate)
+{
+    std::size_t allocations_before = allocation_count;
+    auto begin = std::chrono::steady_clock::now();
+    auto [count, checksum] = enumerate();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now()-begin);
+    std::cout << fmt::format("{:<22} configurations: {:>9}, duration: {:>8} us, per configuration: {:>6.2f} ns, "
+                             "allocations: {:>7}, checksum: {}", name, count, duration.count(),
+            1'000.0*duration.count()/count, allocation_count-allocations_before, checksum) << std::endl;
+}
+
+// enumerates the brute force grid of main
+int main()
+{
+    systematic::levels_generator<n_levels> levels{15, {15, 20}};
+    systematic::sizes_generator<n_levels> sizes{6};
+    systematic::int_range_generator periods{3, 60, 3};
+    etl::vector<bazooka::indicator_tag, 2> tags{bazooka::indicator_tag::sma, bazooka::indicator_tag::ema};
+
+    auto nested = [&]() -> cppcoro::generator<config_t> {
+        for (std::size_t period: periods())
+            for (const auto& tag: tags)
+                for (const auto& curr_levels: levels())
+                    for (const auto& curr_sizes: sizes())
+                        co_yield config_t{tag, period, curr_levels, curr_sizes};
+    };
+    bazooka::search_space<n_levels> space{periods, {tags.begin(), tags.end()}, levels, sizes};
+
+    for (std::size_t rep{0}; rep<3; rep++) {
+        measure("nested generators", [&] {
+            std::size_t count{0}, checksum{0};
+            for (const auto& config: nested()) {
+                count++;
+                checksum += config.period+config.levels[0].numerator()+config.sizes[0].numerator();
+            }
+            return std::pair{count, checksum};
+        });
+        measure("random access", [&] {
+            std::size_t count{0}, checksum{0};
+            for (const auto& config: space.range(0, space.size())) {
+                count++;
+                checksum += config.period+config.levels[0].numerator()+config.sizes[0].numerator();
+            }
+            return std::pair{count, checksum};
+        });
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <fmt/format.h>
+#include <trading/bazooka/live_engine.hpp>
+
+using namespace trading;
+constexpr std::size_t n_levels{3};
+
+std::vector<bazooka::configuration<n_levels>> random_configs(std::size_t count, std::mt19937& gen)
+{
+    std::uniform_int_distribution<std::size_t> period{1, 20}, level{1, 15}, size{1, 4};
+    std::vector<bazooka::configuration<n_levels>> configs;
+    configs.reserve(count);
+
+    for (std::size_t i{0}; i<count; i++) {
+        // levels are decreasing from the baseline
+        std::array<std::size_t, n_levels> nums{level(gen), level(gen), level(gen)};
+        std::sort(nums.begin(), nums.end(), std::greater<>{});
+        std::array<fraction_t, n_levels> levels;
+        for (std::size_t l{0}; l<n_levels; l++)
+            levels[l] = fraction_t{80+nums[l]+n_levels-l, 100};
+
+        std::size_t first{size(gen)}, second{size(gen)};
+        std::size_t third{12-first-second};
+        std::array<fraction_t, n_levels> sizes{{{first, 12}, {second, 12}, {third, 12}}};
+        auto tag = gen()%2 ? bazooka::indicator_tag::ema : bazooka::indicator_tag::sma;
+        configs.emplace_back(bazooka::configuration<n_levels>{tag, 3*period(gen), levels, sizes});
+    }
+    return configs;
+}
+
+std::vector<candle> random_walk(std::size_t count, std::mt19937& gen)
+{
+    std::normal_distribution<double> step{0.0, 0.002};
+    std::vector<candle> candles;
+    candles.reserve(count);
+    double price{100.0};
+
+    for (std::size_t i{0}; i<count; i++) {
+        price *= std::exp(step(gen));
+        auto close = static_cast<price_t>(price);
+        candles.emplace_back(candle{static_cast<std::time_t>(i*60), close, close, close, close});
+    }
+    return candles;
+}
+
+int main()
+{
+    std::mt19937 gen{42};
+    auto candles = random_walk(20'000, gen);
+    trading::fraction_t fee{1, 1'000};
+    trading::market market{trading::wallet{10'000}, fee, fee};
+    trading::time_resampler resampler{std::chrono::seconds(std::chrono::minutes(45)).count()};
+    std::chrono::microseconds budget{1'000};
+
+    for (std::size_t count: {1'000, 10'000, 100'000}) {
+        bazooka::live_engine<n_levels> engine{random_configs(count, gen), market, resampler, 5'000, 5'000, budget};
+        std::chrono::nanoseconds total{0};
+        for (const auto& curr: candles) {
+            engine(curr);
+            total += engine.last_latency();
+        }
+        auto mean = total/candles.size();
+        std::cout << fmt::format("traders: {:>7}, indicators: {:>3}, mean: {:>9} ns, per trader: {:>6.2f} ns, "
+                                 "max: {:>9} ns, over budget: {}", count, engine.indicator_count(), mean.count(),
+                static_cast<double>(mean.count())/count,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(engine.max_latency()).count(),
+                engine.overrun_count()) << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <iostream>
+#include <fmt/format.h>
+#include <trading/phase_simulator.hpp>
+#include <trading/bazooka/trader.hpp>
+#include <trading/bazooka/manager.hpp>
+#include <trading/bazooka/statistics.hpp>
+#include <trading/sma.hpp>
+
+using namespace trading;
+constexpr std::size_t n_levels{3};
+
+// random walk, that keeps the price of the previous candle with the given probability, as an illiquid pair does
+std::vector<candle> illiquid_walk(std::size_t count, double unchanged, std::mt19937& gen)
+{
+    std::normal_distribution<double> step{0.0, 0.002};
+    std::bernoulli_distribution keep{unchanged};
+    std::vector<candle> candles;
+    candles.reserve(count);
+    double price{100.0};
+
+    for (std::size_t i{0}; i<count; i++) {
+        if (!keep(gen)) price *= std::exp(step(gen));
+        auto close = static_cast<price_t>(price);
+        candles.emplace_back(candle{static_cast<std::time_t>(i*60), close, close, close, close});
+    }
+    return candles;
+}
+
+auto create_traders(std::size_t count)
+{
+    fraction_t fee{1, 1'000};
+    market market{wallet{10'000}, fee, fee};
+    bazooka::indicator indic{sma{12}};
+    std::array<fraction_t, n_levels> levels{{{97, 100}, {94, 100}, {90, 100}}};
+    std::array<fraction_t, n_levels> sizes{{{1, 4}, {1, 4}, {2, 4}}};
+    bazooka::trader trader{bazooka::strategy{indic, indic, levels}, bazooka::manager{market, order_sizer{sizes}}};
+    return std::vector<decltype(trader)>(count, trader);
+}
+
+// counts the visited ticks besides collecting the statistics
+struct visit_counter : public bazooka::statistics<n_levels>::collector {
+    std::size_t decided_count{0};
+
+    template<class Trader>
+    void decided(const Trader& trader, action done, const price_point& point)
+    {
+        decided_count++;
+        bazooka::statistics<n_levels>::collector::decided(trader, done, point);
+    }
+};
+
+// simulates all phases of the 45 minute resampling 5 minutes apart, with and without the compaction
+int main()
+{
+    std::mt19937 gen{42};
+    std::time_t candle_period{60}, period{45*60};
+    std::vector<std::time_t> offsets;
+    for (std::time_t offset{0}; offset<period; offset += 5*60)
+        offsets.emplace_back(offset);
+
+    for (double unchanged: {0.0, 0.5, 0.9}) {
+        auto candles = illiquid_walk(1'000'000, unchanged, gen);
+        phase_simulator plain{candles, period, candle_period, offsets, candle::ohlc4{}, 5'000};
+        phase_simulator compacted{candles, period, candle_period, offsets, candle::ohlc4{}, 5'000};
+        compacted.compact();
+
+        for (std::size_t rep{0}; rep<3; rep++) {
+            for (auto* simulator: {&plain, &compacted}) {
+                auto traders = create_traders(offsets.size());
+                std::vector<visit_counter> observers(offsets.size());
+                auto begin = std::chrono::steady_clock::now();
+                (*simulator)(traders, observers);
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now()-begin);
+
+                std::size_t visited{0};
+                for (const auto& observer: observers)
+                    visited += observer.decided_count;
+                std::cout << fmt::format("unchanged: {:.1f}, {:<9} compression ratio: {:>5.2f}, visited ticks: {:>8}, "
+                                         "duration: {:>5} ms, final balance of the first phase: {:.2f}", unchanged,
+                        simulator->compacted() ? "compacted" : "plain", simulator->compression_ratio(), visited,
+                        duration.count(), observers.front().get().final_balance()) << std::endl;
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
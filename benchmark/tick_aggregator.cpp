@@ -0,0 +1,86 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+#include <fmt/format.h>
+#include <trading/tick_aggregator.hpp>
+#include <trading/io/csv/tick_reader.hpp>
+
+using namespace trading;
+
+// trades a few seconds apart with a random walk of the price
+tick_columns random_ticks(std::size_t count, std::mt19937& gen)
+{
+    std::normal_distribution<double> step{0.0, 0.0005};
+    std::uniform_int_distribution<std::time_t> gap{0, 3};
+    tick_columns ticks;
+    ticks.reserve(count);
+    double price{100.0};
+    std::time_t time{1'600'000'000};
+
+    for (std::size_t i{0}; i<count; i++) {
+        price *= std::exp(step(gen));
+        time += gap(gen);
+        ticks.emplace_back(time, static_cast<price_t>(price), 1);
+    }
+    return ticks;
+}
+
+template<class Aggregate>
+void measure(const std::string& name, std::size_t tick_count, Aggregate&& aggregate)
+{
+    auto begin = std::chrono::steady_clock::now();
+    auto candles = aggregate();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now()-begin);
+    std::cout << fmt::format("{:<20} ticks: {:>9}, candles: {:>7}, duration: {:>8} us, "
+                             "throughput: {:>6.2f} M ticks/s", name, tick_count, candles.size(), duration.count(),
+            static_cast<double>(tick_count)/static_cast<double>(duration.count())) << std::endl;
+}
+
+// aggregates the trades into minute candles, in memory and read from a csv file
+int main()
+{
+    std::mt19937 gen{42};
+    constexpr std::size_t tick_count{20'000'000}, batch_size{1 << 16};
+    auto ticks = random_ticks(tick_count, gen);
+
+    std::filesystem::path path{std::filesystem::temp_directory_path()/"tick_aggregator_benchmark.csv"};
+    {
+        std::ofstream file{path};
+        for (std::size_t i{0}; i<ticks.size(); i++)
+            file << ticks.time[i] << ',' << ticks.price[i] << ',' << ticks.quantity[i] << '\n';
+    }
+
+    // batches of about as many trades as a block of the reader holds
+    std::vector<tick_columns> batches;
+    for (std::size_t begin{0}; begin<ticks.size(); begin += batch_size) {
+        auto& batch = batches.emplace_back();
+        for (std::size_t i{begin}; i<std::min(ticks.size(), begin+batch_size); i++)
+            batch.emplace_back(ticks.time[i], ticks.price[i], ticks.quantity[i]);
+    }
+
+    for (std::size_t rep{0}; rep<3; rep++) {
+        measure("aggregation", tick_count, [&] {
+            tick_aggregator aggregator{60};
+            candle_columns candles;
+            for (const auto& batch: batches)
+                aggregator(batch, candles);
+            aggregator.finish(candles);
+            return candles;
+        });
+        measure("read and aggregation", tick_count, [&] {
+            io::csv::tick_reader reader{path};
+            tick_aggregator aggregator{60};
+            return io::csv::aggregate_ticks(reader, aggregator);
+        });
+    }
+    std::filesystem::remove(path);
+    return EXIT_SUCCESS;
+}
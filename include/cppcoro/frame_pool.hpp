@@ -0,0 +1,198 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef CPPCORO_FRAME_POOL_HPP_INCLUDED
+#define CPPCORO_FRAME_POOL_HPP_INCLUDED
+
+#include <array>
+#include <memory>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace cppcoro
+{
+    // Keeps the freed coroutine frames in lists by size class, so the frames of the generators created
+    // in a loop are reused instead of being allocated again. Frames larger than the largest class are
+    // allocated directly. A pool is not thread safe, each thread has its own local one.
+    class frame_pool
+    {
+        // trivially destructible, so it can be read by the destructors of the other thread local objects
+        static bool& torn_down() noexcept
+        {
+            thread_local bool value{false};
+            return value;
+        }
+
+        static constexpr std::size_t granularity{64};
+        static constexpr std::size_t class_count{64};
+
+        struct block
+        {
+            block* next;
+        };
+
+        std::array<block*, class_count> m_free{};
+        std::size_t m_allocated_count{0};
+
+        static constexpr std::size_t size_class(std::size_t size) noexcept
+        {
+            return (size + granularity - 1) / granularity;
+        }
+
+    public:
+        frame_pool() = default;
+        frame_pool(const frame_pool&) = delete;
+        frame_pool& operator=(const frame_pool&) = delete;
+
+        ~frame_pool()
+        {
+            for (block* head : m_free)
+            {
+                while (head != nullptr)
+                {
+                    block* next = head->next;
+                    ::operator delete(head);
+                    head = next;
+                }
+            }
+            torn_down() = true;
+        }
+
+        void* allocate(std::size_t size)
+        {
+            std::size_t index = size_class(size);
+            if (index >= class_count)
+            {
+                m_allocated_count++;
+                return ::operator new(size);
+            }
+
+            if (block* head = m_free[index])
+            {
+                m_free[index] = head->next;
+                return head;
+            }
+            m_allocated_count++;
+            return ::operator new(index * granularity);
+        }
+
+        void deallocate(void* frame, std::size_t size) noexcept
+        {
+            std::size_t index = size_class(size);
+            if (index >= class_count)
+            {
+                ::operator delete(frame);
+                return;
+            }
+
+            auto* freed = static_cast<block*>(frame);
+            freed->next = m_free[index];
+            m_free[index] = freed;
+        }
+
+        // number of frames taken from the global allocator
+        std::size_t allocated_count() const noexcept
+        {
+            return m_allocated_count;
+        }
+
+        static frame_pool& local()
+        {
+            thread_local frame_pool pool;
+            return pool;
+        }
+
+        // the frames of a thread, whose pool is already destroyed, e.g. by the destructor of another thread
+        // local object, are taken from and returned to the global allocator
+        static bool local_alive() noexcept
+        {
+            return !torn_down();
+        }
+
+        static void* allocate_local(std::size_t size)
+        {
+            return local_alive() ? local().allocate(size) : ::operator new(size);
+        }
+
+        static void deallocate_local(void* frame, std::size_t size) noexcept
+        {
+            if (local_alive())
+                local().deallocate(frame, size);
+            else
+                ::operator delete(frame);
+        }
+    };
+
+    namespace detail
+    {
+        // Stored after the frame, so it is returned to the allocator it came from. The frames of the local pools
+        // can be destroyed on another thread (e.g. nested generators resumed by a worker), those are returned
+        // to the pool of the destroying thread.
+        struct frame_deleter
+        {
+            void (*deallocate)(void* frame, std::size_t size) noexcept;
+        };
+
+        constexpr std::size_t align_up(std::size_t size, std::size_t alignment) noexcept
+        {
+            return (size + alignment - 1) / alignment * alignment;
+        }
+
+        constexpr std::size_t deleter_offset(std::size_t size) noexcept
+        {
+            return align_up(size, alignof(frame_deleter));
+        }
+
+        // the copy of the allocator follows the deleter, so the frame does not refer to the argument
+        // of the coroutine, that can be gone when the frame is freed
+        template<typename Allocator>
+        constexpr std::size_t allocator_offset(std::size_t size) noexcept
+        {
+            return align_up(deleter_offset(size) + sizeof(frame_deleter), alignof(Allocator));
+        }
+
+        template<typename Allocator>
+        void* allocate_frame(std::size_t size, const Allocator& allocator)
+        {
+            static_assert(alignof(Allocator) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                    "Allocator is stored in the frame, its alignment cannot exceed the alignment of the frame");
+            std::size_t offset = allocator_offset<Allocator>(size);
+            Allocator copy{allocator};
+            void* frame = copy.allocate(offset + sizeof(Allocator));
+            ::new(static_cast<char*>(frame) + deleter_offset(size)) frame_deleter{
+                    [](void* frame, std::size_t size) noexcept {
+                        std::size_t offset = allocator_offset<Allocator>(size);
+                        auto* stored = std::launder(reinterpret_cast<Allocator*>(static_cast<char*>(frame) + offset));
+                        Allocator allocator{std::move(*stored)};
+                        stored->~Allocator();
+                        allocator.deallocate(frame, offset + sizeof(Allocator));
+                    }
+            };
+            ::new(static_cast<char*>(frame) + offset) Allocator{std::move(copy)};
+            return frame;
+        }
+
+        inline void* allocate_frame(std::size_t size)
+        {
+            std::size_t offset = deleter_offset(size);
+            void* frame = frame_pool::allocate_local(offset + sizeof(frame_deleter));
+            ::new(static_cast<char*>(frame) + offset) frame_deleter{
+                    [](void* frame, std::size_t size) noexcept {
+                        frame_pool::deallocate_local(frame, deleter_offset(size) + sizeof(frame_deleter));
+                    }
+            };
+            return frame;
+        }
+
+        inline void deallocate_frame(void* frame, std::size_t size) noexcept
+        {
+            auto* deleter = std::launder(reinterpret_cast<frame_deleter*>(static_cast<char*>(frame)
+                    + deleter_offset(size)));
+            deleter->deallocate(frame, size);
+        }
+    }
+}
+
+#endif
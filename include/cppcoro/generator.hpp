@@ -5,7 +5,10 @@
 #ifndef CPPCORO_GENERATOR_HPP_INCLUDED
 #define CPPCORO_GENERATOR_HPP_INCLUDED
 
+#include <cppcoro/frame_pool.hpp>
+
 #include <experimental/coroutine>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <exception>
@@ -30,6 +33,29 @@ namespace cppcoro
 
             generator_promise() = default;
 
+            // frames come from the thread local pool, or from a copy of the allocator passed after std::allocator_arg
+            static void* operator new(std::size_t size)
+            {
+                return detail::allocate_frame(size);
+            }
+
+            template<typename Allocator, typename... Args>
+            static void* operator new(std::size_t size, std::allocator_arg_t, Allocator& allocator, Args&...)
+            {
+                return detail::allocate_frame(size, allocator);
+            }
+
+            template<typename This, typename Allocator, typename... Args>
+            static void* operator new(std::size_t size, This&, std::allocator_arg_t, Allocator& allocator, Args&...)
+            {
+                return detail::allocate_frame(size, allocator);
+            }
+
+            static void operator delete(void* frame, std::size_t size) noexcept
+            {
+                detail::deallocate_frame(frame, size);
+            }
+
             generator<T> get_return_object() noexcept;
 
             constexpr std::experimental::suspend_always initial_suspend() const noexcept { return {}; }
@@ -8,6 +8,7 @@
 #include <cppcoro/generator.hpp>
 
 #include <experimental/coroutine>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <cassert>
@@ -34,6 +35,29 @@ namespace cppcoro
             promise_type(const promise_type&) = delete;
             promise_type(promise_type&&) = delete;
 
+            // frames come from the thread local pool, or from a copy of the allocator passed after std::allocator_arg
+            static void* operator new(std::size_t size)
+            {
+                return detail::allocate_frame(size);
+            }
+
+            template<typename Allocator, typename... Args>
+            static void* operator new(std::size_t size, std::allocator_arg_t, Allocator& allocator, Args&...)
+            {
+                return detail::allocate_frame(size, allocator);
+            }
+
+            template<typename This, typename Allocator, typename... Args>
+            static void* operator new(std::size_t size, This&, std::allocator_arg_t, Allocator& allocator, Args&...)
+            {
+                return detail::allocate_frame(size, allocator);
+            }
+
+            static void operator delete(void* frame, std::size_t size) noexcept
+            {
+                detail::deallocate_frame(frame, size);
+            }
+
             auto get_return_object() noexcept
             {
                 return recursive_generator<T>{ *this };
@@ -13,6 +13,8 @@
 #include <trading/bazooka/state.hpp>
 #include <trading/bazooka/statistics.hpp>
 #include <trading/brute_force/parallel/optimizer.hpp>
+#include <trading/brute_force/sharded/optimizer.hpp>
+#include <trading/genetic_algorithm/arena.hpp>
 #include <trading/genetic_algorithm/matchmaker.hpp>
 #include <trading/genetic_algorithm/optimizer.hpp>
 #include <trading/genetic_algorithm/progress_collector.hpp>
@@ -28,10 +30,14 @@
 #include <trading/sma.hpp>
 #include <trading/io/csv/writer.hpp>
 #include <trading/io/csv/reader.hpp>
+#include <trading/io/compressed_ifstream.hpp>
+#include <trading/io/csv/tick_reader.hpp>
 #include <trading/io/parser.hpp>
 #include <trading/io/stringifier.hpp>
+#include <trading/random/engine.hpp>
 #include <trading/random/generators.hpp>
 #include <trading/simulated_annealing/optimizer.hpp>
+#include <trading/simulated_annealing/parallel_tempering.hpp>
 #include <trading/simulated_annealing/cooler.hpp>
 #include <trading/simulated_annealing/equilibrium.hpp>
 #include <trading/simulated_annealing/progress_collector.hpp>
@@ -44,6 +50,9 @@
 #include <trading/tabu_search/tenure.hpp>
 #include <trading/types.hpp>
 #include <trading/candle.hpp>
+#include <trading/candle_validator.hpp>
+#include <trading/tick_aggregator.hpp>
+#include <trading/calendar.hpp>
 #include <trading/chart_series.hpp>
 #include <trading/convert.hpp>
 #include <trading/criterion.hpp>
@@ -54,12 +63,31 @@
 #include <trading/motion_tracker.hpp>
 #include <trading/pack.hpp>
 #include <trading/resampler.hpp>
+#include <trading/time_resampler.hpp>
+#include <trading/candle_pyramid.hpp>
+#include <trading/phase_simulator.hpp>
 #include <trading/result.hpp>
 #include <trading/termination.hpp>
 #include <trading/simulator.hpp>
 #include <trading/sizer.hpp>
 #include <trading/bazooka/manager.hpp>
 #include <trading/bazooka/trader.hpp>
+#include <trading/bazooka/trade_event.hpp>
+#include <trading/bazooka/crossing_bitmaps.hpp>
+#include <trading/bazooka/recording_manager.hpp>
+#include <trading/bazooka/segmented_recorder.hpp>
+#include <trading/bazooka/event_cache.hpp>
+#include <trading/bazooka/live_engine.hpp>
+#include <trading/bazooka/behavior.hpp>
+#include <trading/bazooka/search_space.hpp>
+#include <trading/clock_cache.hpp>
+#include <trading/equivalence.hpp>
+#include <trading/evaluation_cache.hpp>
+#include <trading/iteration_reporter.hpp>
+#include <trading/paper/latency_histogram.hpp>
+#include <trading/paper/log_sink.hpp>
+#include <trading/paper/feed.hpp>
+#include <trading/paper/runner.hpp>
 #include <trading/tuple.hpp>
 #include <trading/utils.hpp>
 #include <trading/order_sizer.hpp>
@@ -0,0 +1,59 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_BAZOOKA_BEHAVIOR_HPP
+#define BACKTESTING_BAZOOKA_BEHAVIOR_HPP
+
+#include <array>
+#include <functional>
+#include <boost/functional/hash.hpp>
+#include <trading/types.hpp>
+#include <trading/order_sizer.hpp>
+#include <trading/bazooka/configuration.hpp>
+
+namespace trading::bazooka {
+    // Canonical key of the trades a configuration makes. Order sizes of the levels deeper than
+    // the deepest level reached are never used, and different sizes can have the same cumulative sizes,
+    // so configurations with equal behavior produce the same trades.
+    template<std::size_t n_levels>
+    struct behavior {
+        indicator_tag tag;
+        std::size_t period;
+        std::array<fraction_t, n_levels> levels;
+        std::array<double, n_levels> cum_sizes;
+
+        behavior(const configuration<n_levels>& config, std::size_t depth)
+                :tag(config.tag), period(config.period), levels(config.levels),
+                 cum_sizes(order_sizer{config.sizes}.cumulative_sizes())
+        {
+            for (std::size_t i{depth}; i<n_levels; i++)
+                cum_sizes[i] = 0.0;
+        }
+
+        bool operator==(const behavior& rhs) const
+        {
+            return tag==rhs.tag &&
+                    period==rhs.period &&
+                    levels==rhs.levels &&
+                    cum_sizes==rhs.cum_sizes;
+        }
+    };
+}
+
+namespace std {
+    template<std::size_t n_levels>
+    struct hash<trading::bazooka::behavior<n_levels>> {
+        std::size_t operator()(const trading::bazooka::behavior<n_levels>& key) const
+        {
+            std::size_t seed{0};
+            boost::hash_combine(seed, boost::hash_value(key.tag));
+            boost::hash_combine(seed, boost::hash_value(key.period));
+            boost::hash_combine(seed, boost::hash_value(key.levels));
+            boost::hash_combine(seed, boost::hash_value(key.cum_sizes));
+            return seed;
+        }
+    };
+}
+
+#endif //BACKTESTING_BAZOOKA_BEHAVIOR_HPP
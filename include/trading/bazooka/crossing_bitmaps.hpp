@@ -0,0 +1,342 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_BAZOOKA_CROSSING_BITMAPS_HPP
+#define BACKTESTING_BAZOOKA_CROSSING_BITMAPS_HPP
+
+#include <bit>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <unordered_map>
+#include <fmt/format.h>
+#include <boost/functional/hash.hpp>
+#include <trading/types.hpp>
+#include <trading/action.hpp>
+#include <trading/data_point.hpp>
+#include <trading/simulator.hpp>
+#include <trading/phase_simulator.hpp>
+#include <trading/bazooka/configuration.hpp>
+#include <trading/bazooka/strategy.hpp>
+#include <trading/bazooka/trade_event.hpp>
+
+namespace trading::bazooka {
+    using bitmap = std::vector<std::uint64_t>;
+
+    // ticks at which the price crosses each unique entry level and the exit indicator
+    struct crossing_set {
+        std::vector<bitmap> entries;
+        bitmap exit;
+
+        std::size_t memory() const
+        {
+            std::size_t words{exit.capacity()};
+            for (const auto& entry: entries)
+                words += entry.capacity();
+            return words*sizeof(std::uint64_t);
+        }
+    };
+
+    // Precomputes per indicator (tag and period) a bitmap of ticks, at which the entry or the exit
+    // of the strategy would trigger, for every unique entry level. The events of any levels are then
+    // found by chasing the next set bit instead of testing every tick.
+    // Least recently used bitmaps are evicted to keep the memory (in bytes) within the budget.
+    template<std::size_t n_levels>
+    class crossing_bitmaps {
+        using key_type = std::pair<indicator_tag, std::size_t>;
+
+        struct entry {
+            std::shared_ptr<const crossing_set> set;
+            std::size_t last_used;
+        };
+
+        const std::vector<price_point>& prices_;
+        const std::vector<price_t>& indic_prices_;
+        const std::vector<index_t>& indic_ends_;
+        const std::vector<index_t>& run_ends_;
+        std::vector<fraction_t> unique_levels_;
+        std::size_t memory_budget_, memory_{0}, clock_{0};
+        std::size_t hit_count_{0}, miss_count_{0}, eviction_count_{0};
+        std::unordered_map<key_type, entry, boost::hash<key_type>> sets_;
+        mutable std::mutex mutex_;
+
+        static std::vector<fraction_t> validate_unique_levels(std::vector<fraction_t>&& unique_levels)
+        {
+            if (unique_levels.empty())
+                throw std::invalid_argument("At least one unique level has to be provided");
+            return unique_levels;
+        }
+
+        std::size_t level_index(const fraction_t& level) const
+        {
+            auto it = std::find_if(unique_levels_.begin(), unique_levels_.end(), [&](const auto& unique) {
+                return unique.numerator()==level.numerator() && unique.denominator()==level.denominator();
+            });
+            if (it==unique_levels_.end())
+                throw std::invalid_argument(fmt::format("Level {}/{} is not indexed", level.numerator(),
+                        level.denominator()));
+            return it-unique_levels_.begin();
+        }
+
+        static void set_range(bitmap& bits, index_t begin, index_t end)
+        {
+            for (; begin<end && begin%64; begin++)
+                bits[begin/64] |= std::uint64_t{1} << (begin%64);
+            for (; begin+64<=end; begin += 64)
+                bits[begin/64] = ~std::uint64_t{0};
+            for (; begin<end; begin++)
+                bits[begin/64] |= std::uint64_t{1} << (begin%64);
+        }
+
+        // the price and the indicators do not change within a run, so each run is compared once
+        std::shared_ptr<const crossing_set> build_runs(strategy<n_levels> strategy) const
+        {
+            const std::size_t n_runs = run_ends_.size();
+            std::vector<price_t> prices(n_runs);
+            std::vector<double> baselines(n_runs), exits(n_runs);
+            constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+            std::size_t indic_idx{0};
+            index_t begin{0};
+
+            for (std::size_t r{0}; r<n_runs; r++) {
+                prices[r] = prices_[begin].data;
+                baselines[r] = strategy.is_ready() ? strategy.entry_indicator().value() : nan;
+                exits[r] = strategy.is_ready() ? strategy.exit_indicator().value() : nan;
+
+                // runs are split after each indicator update
+                if (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==run_ends_[r]-1)
+                    strategy.update_indicators(indic_prices_[indic_idx++]);
+                begin = run_ends_[r];
+            }
+
+            auto set = std::make_shared<crossing_set>();
+            const std::size_t n_words = (prices_.size()+63)/64;
+            set->entries.reserve(unique_levels_.size());
+
+            for (const auto& level: unique_levels_) {
+                auto frac = fraction_cast<price_t>(level);
+                bitmap bits(n_words);
+                begin = 0;
+
+                for (std::size_t r{0}; r<n_runs; r++) {
+                    if (prices[r]<=static_cast<price_t>(baselines[r]*frac))
+                        set_range(bits, begin, run_ends_[r]);
+                    begin = run_ends_[r];
+                }
+                set->entries.emplace_back(std::move(bits));
+            }
+
+            set->exit.resize(n_words);
+            begin = 0;
+            for (std::size_t r{0}; r<n_runs; r++) {
+                if (prices[r]>=exits[r])
+                    set_range(set->exit, begin, run_ends_[r]);
+                begin = run_ends_[r];
+            }
+            return set;
+        }
+
+        // same comparisons as the strategy, NaN when it is not ready
+        std::shared_ptr<const crossing_set> build(strategy<n_levels> strategy) const
+        {
+            if (!run_ends_.empty()) return build_runs(std::move(strategy));
+
+            const std::size_t size = prices_.size();
+            std::vector<price_t> prices(size);
+            std::vector<double> baselines(size), exits(size);
+            constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+            std::size_t indic_idx{0};
+
+            for (index_t i{0}; i<size; i++) {
+                prices[i] = prices_[i].data;
+                baselines[i] = strategy.is_ready() ? strategy.entry_indicator().value() : nan;
+                exits[i] = strategy.is_ready() ? strategy.exit_indicator().value() : nan;
+
+                if (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==i)
+                    strategy.update_indicators(indic_prices_[indic_idx++]);
+            }
+
+            auto set = std::make_shared<crossing_set>();
+            const std::size_t n_words = (size+63)/64;
+            set->entries.reserve(unique_levels_.size());
+
+            for (const auto& level: unique_levels_) {
+                auto frac = fraction_cast<price_t>(level);
+                bitmap bits(n_words);
+
+                for (std::size_t w{0}; w<n_words; w++) {
+                    std::uint64_t word{0};
+                    const std::size_t begin{w*64}, end{std::min(size, begin+64)};
+
+                    #pragma omp simd reduction(|:word)
+                    for (std::size_t i = begin; i<end; i++) {
+                        auto entry = static_cast<price_t>(baselines[i]*frac);
+                        word |= static_cast<std::uint64_t>(prices[i]<=entry) << (i-begin);
+                    }
+                    bits[w] = word;
+                }
+                set->entries.emplace_back(std::move(bits));
+            }
+
+            set->exit.resize(n_words);
+            for (std::size_t w{0}; w<n_words; w++) {
+                std::uint64_t word{0};
+                const std::size_t begin{w*64}, end{std::min(size, begin+64)};
+
+                #pragma omp simd reduction(|:word)
+                for (std::size_t i = begin; i<end; i++)
+                    word |= static_cast<std::uint64_t>(prices[i]>=exits[i]) << (i-begin);
+                set->exit[w] = word;
+            }
+            return set;
+        }
+
+        std::shared_ptr<const crossing_set> find(const configuration<n_levels>& config,
+                const strategy<n_levels>& strategy)
+        {
+            key_type key{config.tag, config.period};
+            {
+                std::lock_guard lock{mutex_};
+                auto it = sets_.find(key);
+                if (it!=sets_.end()) {
+                    it->second.last_used = ++clock_;
+                    hit_count_++;
+                    return it->second.set;
+                }
+            }
+
+            auto set = build(strategy);
+            std::lock_guard lock{mutex_};
+            miss_count_++;
+            auto it = sets_.find(key);
+            if (it!=sets_.end()) return it->second.set;
+
+            std::size_t required = set->memory();
+            if (required>memory_budget_)
+                throw std::runtime_error(fmt::format("Bitmaps of {} B do not fit into memory budget of {} B",
+                        required, memory_budget_));
+
+            while (memory_+required>memory_budget_) {
+                auto lru = std::min_element(sets_.begin(), sets_.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.second.last_used<rhs.second.last_used;
+                });
+                memory_ -= lru->second.set->memory();
+                sets_.erase(lru);
+                eviction_count_++;
+            }
+            memory_ += required;
+            sets_.emplace(key, entry{set, ++clock_});
+            return set;
+        }
+
+        index_t next_set(const bitmap& bits, index_t from) const
+        {
+            if (from>=prices_.size()) return prices_.size();
+            std::size_t w{from/64};
+            std::uint64_t word = bits[w] & (~std::uint64_t{0} << (from%64));
+
+            while (!word) {
+                if (++w==bits.size()) return prices_.size();
+                word = bits[w];
+            }
+            return w*64+std::countr_zero(word);
+        }
+
+    public:
+        // the runs of a compacted simulator are compared at once
+        crossing_bitmaps(const simulator& simulator, std::vector<fraction_t> unique_levels,
+                std::size_t memory_budget)
+                :prices_(simulator.prices()), indic_prices_(simulator.indicator_prices()),
+                 indic_ends_(simulator.indicator_ends()), run_ends_(simulator.run_ends()),
+                 unique_levels_(validate_unique_levels(std::move(unique_levels))), memory_budget_(memory_budget) { }
+
+        crossing_bitmaps(const phase_simulator& simulator, std::size_t phase, std::vector<fraction_t> unique_levels,
+                std::size_t memory_budget)
+                :prices_(simulator.prices()), indic_prices_(simulator.indicator_prices(phase)),
+                 indic_ends_(simulator.indicator_ends(phase)), run_ends_(simulator.run_ends(phase)),
+                 unique_levels_(validate_unique_levels(std::move(unique_levels))), memory_budget_(memory_budget) { }
+
+        // Returns the events of the configuration, the not yet updated strategy is used to build the bitmaps.
+        // Open is preferred over close at the same tick, as in the trader.
+        std::vector<trade_event> operator()(const configuration<n_levels>& config,
+                const strategy<n_levels>& strategy)
+        {
+            std::array<std::size_t, n_levels> level_idxs;
+            for (std::size_t l{0}; l<n_levels; l++)
+                level_idxs[l] = level_index(config.levels[l]);
+
+            auto set = find(config, strategy);
+            std::vector<trade_event> events;
+            std::size_t next_level{0};
+            index_t from{0};
+
+            while (from<prices_.size()) {
+                index_t open = (next_level<n_levels) ? next_set(set->entries[level_idxs[next_level]], from)
+                                                     : prices_.size();
+                index_t close = next_level ? next_set(set->exit, from) : prices_.size();
+                if (open==prices_.size() && close==prices_.size()) break;
+
+                if (open<=close) {
+                    events.emplace_back(trade_event{open, action::opened});
+                    next_level++;
+                    from = open+1;
+                }
+                else {
+                    events.emplace_back(trade_event{close, action::closed_all});
+                    next_level = 0;
+                    from = close+1;
+                }
+            }
+            return events;
+        }
+
+        const std::vector<fraction_t>& unique_levels() const
+        {
+            return unique_levels_;
+        }
+
+        std::size_t memory() const
+        {
+            std::lock_guard lock{mutex_};
+            return memory_;
+        }
+
+        std::size_t memory_budget() const
+        {
+            return memory_budget_;
+        }
+
+        // bytes taken by the bitmaps of one indicator
+        static std::size_t set_memory(std::size_t tick_count, std::size_t unique_level_count)
+        {
+            return (unique_level_count+1)*((tick_count+63)/64)*sizeof(std::uint64_t);
+        }
+
+        // lookups of the bitmaps of an indicator, that were already built
+        std::size_t hit_count() const
+        {
+            std::lock_guard lock{mutex_};
+            return hit_count_;
+        }
+
+        // lookups, that built the bitmaps
+        std::size_t miss_count() const
+        {
+            std::lock_guard lock{mutex_};
+            return miss_count_;
+        }
+
+        std::size_t eviction_count() const
+        {
+            std::lock_guard lock{mutex_};
+            return eviction_count_;
+        }
+    };
+}
+
+#endif //BACKTESTING_BAZOOKA_CROSSING_BITMAPS_HPP
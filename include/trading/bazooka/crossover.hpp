@@ -13,16 +13,20 @@
 #include <etl/list.h>
 #include <trading/types.hpp>
 #include <trading/tuple.hpp>
+#include <trading/random/engine.hpp>
 #include <trading/bazooka/configuration.hpp>
 
 namespace trading::bazooka {
     template<std::size_t n_levels>
     class levels_crossover {
-        std::mt19937 gen_{std::random_device{}()};
+        random::engine gen_;
 
     public:
         using value_type = std::array<fraction_t, n_levels>;
 
+        explicit levels_crossover(random::engine gen = random::device_engine())
+                :gen_{gen} { }
+
         value_type operator()(const value_type& mother, const value_type& father)
         {
             etl::vector<fraction_t, n_levels*2> genes{mother.begin(), mother.end()};
@@ -42,14 +46,15 @@ namespace trading::bazooka {
 
     template<std::size_t n_sizes>
     class sizes_crossover {
-        std::mt19937 gen_{std::random_device{}()};
+        random::engine gen_;
         std::uniform_int_distribution<std::size_t> distrib_;
         std::array<std::size_t, n_sizes> indices_;
 
     public:
         using value_type = std::array<fraction_t, n_sizes>;
 
-        sizes_crossover()
+        explicit sizes_crossover(random::engine gen = random::device_engine())
+                :gen_{gen}
         {
             for (std::size_t i{0}; i<n_sizes; i++)
                 indices_[i] = i;
@@ -96,13 +101,17 @@ namespace trading::bazooka {
         static_assert(n_levels>0 && n_children_>0);
         sizes_crossover<n_levels> sizes_crossover_;
         levels_crossover<n_levels> levels_crossover_;
-        std::mt19937 gen_{std::random_device{}()};
+        random::engine gen_;
         std::uniform_int_distribution<std::size_t> coin_flip_{0, 1};
 
     public:
         constexpr static std::size_t n_parents{2}, n_children{n_children_};
         using config_type = bazooka::configuration<n_levels>;
 
+        // the crossovers of the parts draw from their own streams
+        explicit configuration_crossover(random::engine gen = random::device_engine())
+                :sizes_crossover_(gen.split(0)), levels_crossover_(gen.split(1)), gen_{gen.split(2)} { }
+
         std::array<config_type, n_children> operator()(const std::array<config_type, n_parents>& parents)
         {
             std::array<config_type, n_children> children;
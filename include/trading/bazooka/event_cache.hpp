@@ -0,0 +1,358 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_BAZOOKA_EVENT_CACHE_HPP
+#define BACKTESTING_BAZOOKA_EVENT_CACHE_HPP
+
+#include <array>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+#include <trading/types.hpp>
+#include <trading/action.hpp>
+#include <trading/data_point.hpp>
+#include <trading/simulator.hpp>
+#include <trading/phase_simulator.hpp>
+#include <trading/bazooka/configuration.hpp>
+#include <trading/bazooka/strategy.hpp>
+#include <trading/bazooka/trader.hpp>
+#include <trading/bazooka/trade_event.hpp>
+#include <trading/bazooka/crossing_bitmaps.hpp>
+#include <trading/bazooka/recording_manager.hpp>
+#include <trading/bazooka/segmented_recorder.hpp>
+
+namespace trading::bazooka {
+    // Events of a strategy together with the ticks in between them, that can change the equity statistics
+    // for any order sizes: the running extremes and the extremes since the last running extreme.
+    struct event_log {
+        std::vector<trade_event> events;
+        std::vector<index_t> extremes;
+        std::vector<std::size_t> extreme_ends;  // end of the extremes following each event
+        std::size_t depth{0};                   // most open orders within one position
+    };
+
+    struct event_key {
+        indicator_tag tag;
+        std::size_t period;
+        std::vector<fraction_t> levels;
+
+        bool operator==(const event_key& rhs) const
+        {
+            return tag==rhs.tag && period==rhs.period && levels==rhs.levels;
+        }
+    };
+
+    struct event_key_hash {
+        std::size_t operator()(const event_key& key) const
+        {
+            std::size_t seed{0};
+            boost::hash_combine(seed, boost::hash_value(key.tag));
+            boost::hash_combine(seed, boost::hash_value(key.period));
+            boost::hash_combine(seed, boost::hash_value(key.levels));
+            return seed;
+        }
+    };
+
+    // follows recorded events instead of a strategy
+    template<class Manager>
+    class replay_trader : public Manager {
+        std::size_t next_level_{0};
+
+    public:
+        explicit replay_trader(const Manager& manager)
+                :Manager{manager} { }
+
+        void operator()(action done, const price_point& point)
+        {
+            if (done==action::opened) {
+                Manager::create_open_order(point);
+                next_level_++;
+            }
+            else if (done==action::closed_all) {
+                Manager::create_close_all_order(point);
+                next_level_ = 0;
+            }
+        }
+
+        std::size_t next_entry_level() const
+        {
+            return next_level_;
+        }
+    };
+
+    // follows recorded events, the strategy only keeps the indicators up to date for the observers
+    template<std::size_t n_levels, class Manager>
+    class indicator_replay_trader : public strategy<n_levels>, public Manager {
+        std::size_t next_level_{0};
+
+    public:
+        indicator_replay_trader(const strategy<n_levels>& strategy, const Manager& manager)
+                :bazooka::strategy<n_levels>{strategy}, Manager{manager} { }
+
+        void operator()(action done, const price_point& point)
+        {
+            if (done==action::opened) {
+                Manager::create_open_order(point);
+                next_level_++;
+            }
+            else if (done==action::closed_all) {
+                Manager::create_close_all_order(point);
+                next_level_ = 0;
+            }
+        }
+
+        std::size_t next_entry_level() const
+        {
+            return next_level_;
+        }
+    };
+
+    // Caches the trade events of strategies, which only depend on the indicator and the entry levels,
+    // so the order sizes variants are evaluated in O(number of trades) instead of re-simulating.
+    // The equity is monotonic in the price while a position is held, so only the ticks that can move
+    // the extremes, drawdown, run-up or trigger the minimum equity stop are replayed.
+    // It can be shared between threads.
+    template<std::size_t n_levels>
+    class event_cache {
+        const std::vector<price_point>& prices_;
+        const std::vector<price_t>& indic_prices_;
+        const std::vector<index_t>& indic_ends_;
+        const std::vector<index_t>& run_ends_;
+        amount_t min_equity_;
+        std::size_t capacity_;
+        crossing_bitmaps<n_levels>* bitmaps_{nullptr};
+        const segmented_recorder<n_levels>* recorder_{nullptr};
+        std::unordered_map<event_key, std::shared_ptr<const event_log>, event_key_hash> logs_;
+        mutable std::shared_mutex mutex_;
+
+        static event_key make_key(const configuration<n_levels>& config)
+        {
+            return event_key{config.tag, config.period, {config.levels.begin(), config.levels.end()}};
+        }
+
+        void add_extremes(index_t begin, index_t end, std::vector<index_t>& extremes) const
+        {
+            price_t max{std::numeric_limits<price_t>::lowest()}, min{std::numeric_limits<price_t>::max()};
+            price_t min_since_max{max}, max_since_min{min};
+
+            for (index_t i{begin}; i<end; i++) {
+                price_t curr = prices_[i].data;
+                bool keep{false};
+
+                if (curr>max) {
+                    max = min_since_max = curr;
+                    keep = true;
+                }
+                else if (curr<min_since_max) {
+                    min_since_max = curr;
+                    keep = true;
+                }
+
+                if (curr<min) {
+                    min = max_since_min = curr;
+                    keep = true;
+                }
+                else if (curr>max_since_min) {
+                    max_since_min = curr;
+                    keep = true;
+                }
+
+                if (keep) extremes.emplace_back(i);
+            }
+        }
+
+        std::shared_ptr<const event_log> record(const configuration<n_levels>& config,
+                const strategy<n_levels>& strategy) const
+        {
+            auto log = std::make_shared<event_log>();
+
+            if (bitmaps_) {
+                log->events = (*bitmaps_)(config, strategy);
+            }
+            else if (recorder_) {
+                log->events = (*recorder_)(strategy);
+            }
+            else if (!run_ends_.empty()) {
+                trader recorder{strategy, recording_manager{}};
+                std::size_t indic_idx{0};
+                index_t begin{0};
+
+                // the rest of a run is skipped once a tick makes no decision
+                for (index_t end: run_ends_) {
+                    for (index_t i{begin}; i<end; i++) {
+                        auto done = recorder(prices_[i]);
+                        if (done==action::none) break;
+                        log->events.emplace_back(trade_event{i, done});
+                    }
+
+                    if (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==end-1)
+                        recorder.update_indicators(indic_prices_[indic_idx++]);
+                    begin = end;
+                }
+            }
+            else {
+                trader recorder{strategy, recording_manager{}};
+                std::size_t indic_idx{0};
+
+                for (index_t i{0}; i<prices_.size(); i++) {
+                    auto done = recorder(prices_[i]);
+                    if (done!=action::none)
+                        log->events.emplace_back(trade_event{i, done});
+
+                    if (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==i)
+                        recorder.update_indicators(indic_prices_[indic_idx++]);
+                }
+            }
+
+            log->extreme_ends.reserve(log->events.size());
+            std::size_t n_open{0};
+            for (std::size_t k{0}; k<log->events.size(); k++) {
+                index_t end = (k+1<log->events.size()) ? log->events[k+1].tick : prices_.size();
+                if (log->events[k].done==action::opened) {
+                    add_extremes(log->events[k].tick+1, end, log->extremes);
+                    log->depth = std::max(log->depth, ++n_open);
+                }
+                else {
+                    n_open = 0;
+                }
+                log->extreme_ends.emplace_back(log->extremes.size());
+            }
+            return log;
+        }
+
+        bool below_min_equity(const auto& trader, const price_point& point) const
+        {
+            return !(trader.equity(point.data)>min_equity_);
+        }
+
+    public:
+        // the rest of a run of a compacted simulator is skipped when recording
+        explicit event_cache(const simulator& simulator, std::size_t capacity = 1'024)
+                :prices_(simulator.prices()), indic_prices_(simulator.indicator_prices()),
+                 indic_ends_(simulator.indicator_ends()), run_ends_(simulator.run_ends()),
+                 min_equity_(simulator.minimum_equity()), capacity_(capacity) { }
+
+        event_cache(const phase_simulator& simulator, std::size_t phase, std::size_t capacity = 1'024)
+                :prices_(simulator.prices()), indic_prices_(simulator.indicator_prices(phase)),
+                 indic_ends_(simulator.indicator_ends(phase)), run_ends_(simulator.run_ends(phase)),
+                 min_equity_(simulator.minimum_equity()), capacity_(capacity) { }
+
+        // records the events by chasing the crossing bitmaps instead of simulating the strategy
+        void use(crossing_bitmaps<n_levels>& bitmaps)
+        {
+            bitmaps_ = &bitmaps;
+        }
+
+        // records the events of the segments in parallel, bitmaps are preferred when used as well
+        void use(const segmented_recorder<n_levels>& recorder)
+        {
+            recorder_ = &recorder;
+        }
+
+        // returns the events of the configuration, the strategy is used to record them when not cached
+        std::shared_ptr<const event_log> events(const configuration<n_levels>& config,
+                const strategy<n_levels>& strategy)
+        {
+            auto key = make_key(config);
+            {
+                std::shared_lock lock{mutex_};
+                auto it = logs_.find(key);
+                if (it!=logs_.end()) return it->second;
+            }
+
+            auto log = record(config, strategy);
+            std::unique_lock lock{mutex_};
+
+            // evicts an arbitrary log when full
+            if (logs_.size()>=capacity_ && !logs_.contains(key)) logs_.erase(logs_.begin());
+            return logs_.emplace(std::move(key), std::move(log)).first->second;
+        }
+
+        // Replays the events with the manager. Observers see the events and only the ticks that can change
+        // the equity statistics, which is enough for bazooka::statistics::collector.
+        template<class Manager, class... Observer>
+        void operator()(const configuration<n_levels>& config, const strategy<n_levels>& strategy,
+                const Manager& manager, Observer& ... observers)
+        {
+            auto log = events(config, strategy);
+            replay_trader<Manager> trader{manager};
+
+            // no position is held before the first event
+            bool stopped = (log->events.empty() || log->events.front().tick>0) &&
+                    below_min_equity(trader, prices_.front());
+
+            (observers.started(trader, prices_.front()), ...);
+            for (std::size_t k{0}; k<log->events.size() && !stopped; k++) {
+                const auto& [tick, done] = log->events[k];
+                if (below_min_equity(trader, prices_[tick])) break;
+
+                trader(done, prices_[tick]);
+                (observers.decided(trader, done, prices_[tick]), ...);
+
+                if (trader.position_active()) {
+                    (observers.position_active(trader, prices_[tick]), ...);
+
+                    for (std::size_t z{k ? log->extreme_ends[k-1] : 0}; z<log->extreme_ends[k]; z++) {
+                        const auto& point = prices_[log->extremes[z]];
+                        if ((stopped = below_min_equity(trader, point))) break;
+                        (observers.position_active(trader, point), ...);
+                    }
+                }
+                else {
+                    index_t end = (k+1<log->events.size()) ? log->events[k+1].tick : prices_.size();
+                    stopped = tick+1<end && below_min_equity(trader, prices_[tick+1]);
+                }
+            }
+            (observers.finished(trader, prices_.back()), ...);
+        }
+
+        // Replays the events with the manager at every tick, for the observers that need all of them,
+        // such as the windowed statistics or the chart series. The result is the same as of the simulator,
+        // but the strategy is only updated, so the events can be recorded in parallel segments beforehand.
+        template<class Manager, class... Observer>
+        void replay_ticks(const configuration<n_levels>& config, const strategy<n_levels>& strategy,
+                const Manager& manager, Observer& ... observers)
+        {
+            auto log = events(config, strategy);
+            indicator_replay_trader<n_levels, Manager> trader{strategy, manager};
+            std::size_t indic_idx{0}, next_event{0};
+
+            (observers.started(trader, prices_.front()), ...);
+            for (index_t i{0}; i<prices_.size() && !below_min_equity(trader, prices_[i]); i++) {
+                action done{action::none};
+                if (next_event<log->events.size() && log->events[next_event].tick==i)
+                    done = log->events[next_event++].done;
+
+                trader(done, prices_[i]);
+                (observers.decided(trader, done, prices_[i]), ...);
+
+                if (trader.position_active())
+                    (observers.position_active(trader, prices_[i]), ...);
+
+                if (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==i)
+                    if (trader.update_indicators(indic_prices_[indic_idx++]))
+                        (observers.indicators_updated(trader, prices_[i]), ...);
+            }
+            (observers.finished(trader, prices_.back()), ...);
+        }
+
+        std::size_t size() const
+        {
+            std::shared_lock lock{mutex_};
+            return logs_.size();
+        }
+
+        std::size_t capacity() const
+        {
+            return capacity_;
+        }
+    };
+}
+
+#endif //BACKTESTING_BAZOOKA_EVENT_CACHE_HPP
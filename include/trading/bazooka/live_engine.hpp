@@ -0,0 +1,339 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_BAZOOKA_LIVE_ENGINE_HPP
+#define BACKTESTING_BAZOOKA_LIVE_ENGINE_HPP
+
+#include <array>
+#include <cmath>
+#include <chrono>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+#include <trading/types.hpp>
+#include <trading/candle.hpp>
+#include <trading/market.hpp>
+#include <trading/action.hpp>
+#include <trading/interface.hpp>
+#include <trading/data_point.hpp>
+#include <trading/validate.hpp>
+#include <trading/order_sizer.hpp>
+#include <trading/time_resampler.hpp>
+#include <trading/sma.hpp>
+#include <trading/ema.hpp>
+#include <trading/bazooka/indicator.hpp>
+#include <trading/bazooka/manager.hpp>
+#include <trading/bazooka/configuration.hpp>
+
+namespace trading::bazooka {
+    // Trades many configurations on paper as the candles arrive, deciding the same as bazooka::trader
+    // driven by the simulator with the same resampler. The decision state is kept in a structure of arrays
+    // and all traders are checked in one vectorized loop, only the traders that decided touch their manager.
+    // Indicators are shared by the configurations with the same tag and period.
+    // The configurations are ranked by the current equity.
+    template<std::size_t n_levels, IAverager Averager = candle::ohlc4>
+    class live_engine {
+        using clock = std::chrono::steady_clock;
+        using key_type = std::pair<indicator_tag, std::size_t>;
+
+        enum decision : std::uint8_t {
+            none,
+            open,
+            close,
+        };
+
+        // same update as the strategy, the exit indicator is only updated once the entry indicator is ready
+        struct indicator_pair {
+            indicator entry, exit;
+            bool ready{false};
+        };
+
+        std::vector<configuration<n_levels>> configs_;
+        live_resampler resampler_;
+        amount_t min_equity_;
+        std::size_t top_k_;
+        clock::duration latency_budget_;
+        Averager averager_;
+
+        // shared indicators
+        std::vector<indicator_pair> indics_;
+        std::vector<price_t> exit_values_;      // the lowest prices that reach the exit
+
+        // traders
+        std::vector<std::uint32_t> indic_idxs_;
+        std::vector<price_t> levels_;           // entry level fractions, n_levels per trader
+        std::vector<price_t> entry_values_;     // n_levels per trader
+        std::vector<price_t> next_entries_, exits_;
+        std::vector<std::uint8_t> next_levels_;
+        std::vector<std::uint8_t> stopped_;
+        std::vector<std::uint8_t> decisions_;
+        std::vector<amount_t> balances_, sizes_, equities_;
+        std::vector<bazooka::manager<n_levels>> managers_;
+        amount_t close_keep_;
+
+        mutable std::vector<std::size_t> ranks_, top_;
+        mutable bool ranked_{false};
+        std::size_t candle_count_{0}, overrun_count_{0};
+        clock::duration last_latency_{0}, max_latency_{0};
+
+        static std::vector<configuration<n_levels>> validate_configs(std::vector<configuration<n_levels>>&& configs)
+        {
+            if (configs.empty())
+                throw std::invalid_argument("At least one configuration has to be provided");
+            return configs;
+        }
+
+        static std::size_t validate_top_k(std::size_t top_k)
+        {
+            if (!top_k)
+                throw std::invalid_argument("Top k has to be greater than zero");
+            return top_k;
+        }
+
+        static indicator create_indicator(const key_type& key)
+        {
+            indicator indic;
+            if (key.first==indicator_tag::ema)
+                indic = ema{key.second};
+            else
+                indic = sma{key.second};
+            return indic;
+        }
+
+        static constexpr price_t never_opens{-std::numeric_limits<price_t>::infinity()};
+        static constexpr price_t never_closes{std::numeric_limits<price_t>::infinity()};
+
+        // the price is compared with the exit in double precision by the strategy
+        static price_t lowest_reaching(double value)
+        {
+            auto rounded = static_cast<price_t>(value);
+            return (rounded<value) ? std::nextafter(rounded, never_closes) : rounded;
+        }
+
+        // thresholds of the next decision of the trader
+        void refresh(std::size_t i)
+        {
+            const auto& indic = indics_[indic_idxs_[i]];
+            std::uint8_t next = next_levels_[i];
+            next_entries_[i] = (indic.ready && next<n_levels) ? entry_values_[i*n_levels+next] : never_opens;
+            exits_[i] = (indic.ready && next) ? exit_values_[indic_idxs_[i]] : never_closes;
+        }
+
+        void close_bucket(const candle& resampled)
+        {
+            price_t price = averager_(resampled);
+
+            for (auto& indic: indics_)
+                indic.ready = indic.entry.update(price) && indic.exit.update(price);
+
+            for (std::size_t u{0}; u<indics_.size(); u++)
+                if (indics_[u].ready) exit_values_[u] = lowest_reaching(indics_[u].exit.value());
+
+            for (std::size_t i{0}; i<configs_.size(); i++) {
+                const auto& indic = indics_[indic_idxs_[i]];
+                if (indic.ready) {
+                    double baseline = indic.entry.value();
+                    for (std::size_t l{0}; l<n_levels; l++)
+                        entry_values_[i*n_levels+l] = static_cast<price_t>(baseline*levels_[i*n_levels+l]);
+                }
+                refresh(i);
+            }
+        }
+
+        void decide(const price_point& point)
+        {
+            const std::size_t size = configs_.size();
+            const price_t price = point.data;
+            const amount_t min_equity = min_equity_, close_keep = close_keep_;
+            const amount_t* balances = balances_.data();
+            const amount_t* sizes = sizes_.data();
+            const price_t* next_entries = next_entries_.data();
+            const price_t* exits = exits_.data();
+            std::uint8_t* stopped = stopped_.data();
+            std::uint8_t* decisions = decisions_.data();
+            std::size_t decided{0};
+
+            #pragma omp simd reduction(+:decided)
+            for (std::size_t i = 0; i<size; i++) {
+                amount_t equity = balances[i]+(price*sizes[i])*close_keep;
+                std::uint8_t stops = stopped[i] | !(equity>min_equity);
+                std::uint8_t decision = (price<=next_entries[i]) ? open : ((price>=exits[i]) ? close : none);
+                stopped[i] = stops;
+                decisions[i] = stops ? static_cast<std::uint8_t>(none) : decision;
+                decided += decisions[i]!=none;
+            }
+
+            for (std::size_t i{0}; decided && i<size; i++) {
+                if (decisions[i]==none) continue;
+
+                if (decisions[i]==open) {
+                    managers_[i].create_open_order(point);
+                    next_levels_[i]++;
+                }
+                else {
+                    managers_[i].create_close_all_order(point);
+                    next_levels_[i] = 0;
+                }
+                const auto& market = managers_[i].market();
+                balances_[i] = market.wallet_balance();
+                sizes_[i] = next_levels_[i] ? market.active_position().size() : amount_t{0.0};
+                refresh(i);
+                decided--;
+            }
+
+            // equity of the stopped traders stays as it was when they stopped
+            amount_t* equities = equities_.data();
+            #pragma omp simd
+            for (std::size_t i = 0; i<size; i++)
+                if (!stopped[i]) equities[i] = balances[i]+(price*sizes[i])*close_keep;
+        }
+
+        void rank() const
+        {
+            auto k = std::min(top_k_, ranks_.size());
+            auto better = [&](auto lhs, auto rhs) {
+                return equities_[lhs]>equities_[rhs] || (equities_[lhs]==equities_[rhs] && lhs<rhs);
+            };
+            std::nth_element(ranks_.begin(), ranks_.begin()+k-1, ranks_.end(), better);
+            std::sort(ranks_.begin(), ranks_.begin()+k, better);
+            top_.assign(ranks_.begin(), ranks_.begin()+k);
+            ranked_ = true;
+        }
+
+    public:
+        live_engine(std::vector<configuration<n_levels>> configs, const market& market,
+                const time_resampler& resampler, amount_t min_equity, std::size_t top_k,
+                std::chrono::nanoseconds latency_budget, Averager averager = Averager{})
+                :configs_(validate_configs(std::move(configs))), resampler_(resampler), min_equity_(min_equity),
+                 top_k_(validate_top_k(top_k)), latency_budget_(latency_budget), averager_(averager),
+                 close_keep_(fraction_cast<amount_t>(fraction_t{market.close_fee().denominator(),
+                                                                market.close_fee().denominator()}-market.close_fee()))
+        {
+            const std::size_t size = configs_.size();
+            std::unordered_map<key_type, std::uint32_t, boost::hash<key_type>> indic_idxs;
+            indic_idxs_.reserve(size);
+            levels_.reserve(size*n_levels);
+            managers_.reserve(size);
+
+            for (const auto& config: configs_) {
+                key_type key{config.tag, config.period};
+                auto [it, inserted] = indic_idxs.try_emplace(key, indics_.size());
+                if (inserted) {
+                    auto indic = create_indicator(key);
+                    indics_.emplace_back(indicator_pair{indic, indic});
+                }
+                indic_idxs_.emplace_back(it->second);
+
+                for (const auto& level: validate_levels(config.levels))
+                    levels_.emplace_back(fraction_cast<price_t>(level));
+                managers_.emplace_back(market, order_sizer<n_levels>{config.sizes});
+            }
+
+            exit_values_.assign(indics_.size(), never_closes);
+            entry_values_.assign(size*n_levels, never_opens);
+            next_entries_.assign(size, never_opens);
+            exits_.assign(size, never_closes);
+            next_levels_.assign(size, 0);
+            stopped_.assign(size, false);
+            decisions_.assign(size, none);
+            balances_.assign(size, market.wallet_balance());
+            sizes_.assign(size, 0.0);
+            equities_.assign(size, market.wallet_balance());
+            ranks_.resize(size);
+            for (std::size_t i{0}; i<size; i++) ranks_[i] = i;
+        }
+
+        // Processes a new candle, the candles have to arrive in chronological order.
+        // The indicators are updated at the end of each bucket of the resampler, as in the simulator.
+        void operator()(const candle& curr)
+        {
+            auto began = clock::now();
+
+            if (auto closed = resampler_.add(curr)) close_bucket(*closed);
+            decide(price_point{curr.opened(), curr.close()});
+            if (auto closed = resampler_.complete(curr)) close_bucket(*closed);
+            ranked_ = false;
+
+            candle_count_++;
+            last_latency_ = clock::now()-began;
+            max_latency_ = std::max(max_latency_, last_latency_);
+            overrun_count_ += last_latency_>latency_budget_;
+        }
+
+        // indices of the best configurations, the best first, ranked on demand once per candle
+        const std::vector<std::size_t>& top() const
+        {
+            if (!ranked_) rank();
+            return top_;
+        }
+
+        const configuration<n_levels>& config(std::size_t idx) const
+        {
+            return configs_[idx];
+        }
+
+        amount_t equity(std::size_t idx) const
+        {
+            return equities_[idx];
+        }
+
+        std::size_t next_entry_level(std::size_t idx) const
+        {
+            return next_levels_[idx];
+        }
+
+        bool stopped(std::size_t idx) const
+        {
+            return stopped_[idx];
+        }
+
+        const bazooka::manager<n_levels>& manager(std::size_t idx) const
+        {
+            return managers_[idx];
+        }
+
+        std::size_t size() const
+        {
+            return configs_.size();
+        }
+
+        std::size_t indicator_count() const
+        {
+            return indics_.size();
+        }
+
+        std::size_t candle_count() const
+        {
+            return candle_count_;
+        }
+
+        // number of candles processed over the latency budget
+        std::size_t overrun_count() const
+        {
+            return overrun_count_;
+        }
+
+        clock::duration last_latency() const
+        {
+            return last_latency_;
+        }
+
+        clock::duration max_latency() const
+        {
+            return max_latency_;
+        }
+
+        clock::duration latency_budget() const
+        {
+            return latency_budget_;
+        }
+    };
+}
+
+#endif //BACKTESTING_BAZOOKA_LIVE_ENGINE_HPP
@@ -21,7 +21,7 @@ namespace trading::bazooka {
     class neighbor {
         static const std::size_t n_choices{4};
         std::uniform_int_distribution<std::size_t> choose_{0, n_choices-1};
-        std::mt19937 gen_{std::random_device{}()};
+        random::engine gen_;
         trading::random::levels_generator<n_levels> rand_levels_;
         trading::random::sizes_generator<n_levels> rand_sizes_;
         trading::random::int_range_generator rand_period_;
@@ -41,8 +41,9 @@ namespace trading::bazooka {
 
     public:
         explicit neighbor(const random::levels_generator<n_levels>& levels_gen,
-                const random::sizes_generator<n_levels>& open_sizes_gen, const random::int_range_generator& period_gen)
-                :rand_levels_(levels_gen), rand_sizes_(open_sizes_gen), rand_period_(period_gen) { }
+                const random::sizes_generator<n_levels>& open_sizes_gen, const random::int_range_generator& period_gen,
+                random::engine gen = random::device_engine())
+                :gen_{gen}, rand_levels_(levels_gen), rand_sizes_(open_sizes_gen), rand_period_(period_gen) { }
 
         std::tuple<configuration<n_levels>, movement<n_levels>> operator()(const configuration<n_levels>& origin)
         {
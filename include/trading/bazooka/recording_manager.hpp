@@ -0,0 +1,33 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_BAZOOKA_RECORDING_MANAGER_HPP
+#define BACKTESTING_BAZOOKA_RECORDING_MANAGER_HPP
+
+#include <trading/data_point.hpp>
+
+namespace trading::bazooka {
+    // only tracks whether a position would be open
+    class recording_manager {
+        bool active_{false};
+
+    public:
+        void create_open_order(const price_point&)
+        {
+            active_ = true;
+        }
+
+        void create_close_all_order(const price_point&)
+        {
+            active_ = false;
+        }
+
+        bool position_active() const
+        {
+            return active_;
+        }
+    };
+}
+
+#endif //BACKTESTING_BAZOOKA_RECORDING_MANAGER_HPP
@@ -0,0 +1,97 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_BAZOOKA_SEARCH_SPACE_HPP
+#define BACKTESTING_BAZOOKA_SEARCH_SPACE_HPP
+
+#include <ranges>
+#include <vector>
+#include <stdexcept>
+#include <trading/systematic/generators.hpp>
+#include <trading/bazooka/configuration.hpp>
+
+namespace trading::bazooka {
+    // All configurations of the periods, tags, levels and sizes, in the order of the nested loops over them.
+    // The configuration at any index is computed directly, so the space can be counted and split into ranges
+    // without generating it.
+    template<std::size_t n_levels>
+    class search_space {
+        systematic::int_range_generator periods_;
+        std::vector<indicator_tag> tags_;
+        systematic::levels_generator<n_levels> levels_;
+        systematic::sizes_generator<n_levels> sizes_;
+
+        static std::vector<indicator_tag> validate_tags(std::vector<indicator_tag>&& tags)
+        {
+            if (tags.empty())
+                throw std::invalid_argument("At least one indicator tag has to be provided");
+            return tags;
+        }
+
+    public:
+        search_space(const systematic::int_range_generator& periods, std::vector<indicator_tag> tags,
+                const systematic::levels_generator<n_levels>& levels, const systematic::sizes_generator<n_levels>& sizes)
+                :periods_(periods), tags_(validate_tags(std::move(tags))), levels_(levels), sizes_(sizes) { }
+
+        std::size_t size() const
+        {
+            return periods_.value_count()*tags_.size()*levels_.value_count()*sizes_.value_count();
+        }
+
+        configuration<n_levels> at(std::size_t index) const
+        {
+            if (index>=size())
+                throw std::out_of_range("Index of configuration is out of range");
+
+            std::size_t sizes_idx = index%sizes_.value_count();
+            index /= sizes_.value_count();
+            std::size_t levels_idx = index%levels_.value_count();
+            index /= levels_.value_count();
+            std::size_t tag_idx = index%tags_.size();
+            return {tags_[tag_idx], static_cast<std::size_t>(periods_.at(index/tags_.size())),
+                    levels_.at(levels_idx), sizes_.at(sizes_idx)};
+        }
+
+        std::size_t index_of(const configuration<n_levels>& config) const
+        {
+            auto tag = std::find(tags_.begin(), tags_.end(), config.tag);
+            if (tag==tags_.end())
+                throw std::invalid_argument("Indicator tag is not in the search space");
+
+            std::size_t index = periods_.index_of(static_cast<int>(config.period));
+            index = index*tags_.size()+(tag-tags_.begin());
+            index = index*levels_.value_count()+levels_.index_of(config.levels);
+            return index*sizes_.value_count()+sizes_.index_of(config.sizes);
+        }
+
+        // configurations in [begin, end)
+        auto range(std::size_t begin, std::size_t end) const
+        {
+            return std::views::iota(begin, std::min(end, size()))
+                    | std::views::transform([this](std::size_t index) { return at(index); });
+        }
+
+        const systematic::int_range_generator& periods() const
+        {
+            return periods_;
+        }
+
+        const std::vector<indicator_tag>& tags() const
+        {
+            return tags_;
+        }
+
+        const systematic::levels_generator<n_levels>& levels() const
+        {
+            return levels_;
+        }
+
+        const systematic::sizes_generator<n_levels>& sizes() const
+        {
+            return sizes_;
+        }
+    };
+}
+
+#endif //BACKTESTING_BAZOOKA_SEARCH_SPACE_HPP
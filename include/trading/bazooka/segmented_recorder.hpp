@@ -0,0 +1,128 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_BAZOOKA_SEGMENTED_RECORDER_HPP
+#define BACKTESTING_BAZOOKA_SEGMENTED_RECORDER_HPP
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <trading/types.hpp>
+#include <trading/action.hpp>
+#include <trading/data_point.hpp>
+#include <trading/simulator.hpp>
+#include <trading/phase_simulator.hpp>
+#include <trading/bazooka/strategy.hpp>
+#include <trading/bazooka/trader.hpp>
+#include <trading/bazooka/trade_event.hpp>
+#include <trading/bazooka/recording_manager.hpp>
+
+namespace trading::bazooka {
+    // Records the trade events of a strategy by splitting the prices into segments, that are simulated
+    // in parallel. The indicators do not depend on the trades, so the entry state of each segment is known
+    // except for the position, which is speculated to be closed. While stitching, a segment with a wrong
+    // speculation is re-simulated only until its state meets the speculated one, usually at the first close all.
+    // The events are the same as of the sequential simulation.
+    template<std::size_t n_levels>
+    class segmented_recorder {
+        using recorder_type = trader<strategy<n_levels>, recording_manager>;
+
+        struct segment {
+            recorder_type recorder;
+            std::size_t indic_idx;
+            std::vector<trade_event> events;
+        };
+
+        const std::vector<price_point>& prices_;
+        const std::vector<price_t>& indic_prices_;
+        const std::vector<index_t>& indic_ends_;
+        std::size_t segment_count_;
+
+        static std::size_t validate_segment_count(std::size_t segment_count)
+        {
+            if (!segment_count)
+                throw std::invalid_argument("The number of segments has to be greater than zero");
+            return segment_count;
+        }
+
+        action step(recorder_type& recorder, std::size_t& indic_idx, index_t i) const
+        {
+            auto done = recorder(prices_[i]);
+            if (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==i)
+                recorder.update_indicators(indic_prices_[indic_idx++]);
+            return done;
+        }
+
+    public:
+        segmented_recorder(const simulator& simulator, std::size_t segment_count)
+                :prices_(simulator.prices()), indic_prices_(simulator.indicator_prices()),
+                 indic_ends_(simulator.indicator_ends()), segment_count_(validate_segment_count(segment_count)) { }
+
+        segmented_recorder(const phase_simulator& simulator, std::size_t phase, std::size_t segment_count)
+                :prices_(simulator.prices()), indic_prices_(simulator.indicator_prices(phase)),
+                 indic_ends_(simulator.indicator_ends(phase)), segment_count_(validate_segment_count(segment_count)) { }
+
+        // the strategy has not been updated yet
+        std::vector<trade_event> operator()(const strategy<n_levels>& strategy) const
+        {
+            const std::size_t size = prices_.size();
+            const std::size_t length = (size+segment_count_-1)/segment_count_;
+            std::vector<segment> segments;
+            segments.reserve(segment_count_);
+
+            // entry states without a position
+            recorder_type recorder{strategy, recording_manager{}};
+            std::size_t indic_idx{0};
+            for (index_t begin{0}; begin<size; begin += length) {
+                while (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]<begin)
+                    recorder.update_indicators(indic_prices_[indic_idx++]);
+                segments.emplace_back(segment{recorder, indic_idx, {}});
+            }
+
+            #pragma omp parallel for schedule(dynamic, 1)
+            for (std::size_t k = 0; k<segments.size(); k++) {
+                auto& seg = segments[k];
+                for (index_t i{k*length}; i<std::min(size, (k+1)*length); i++) {
+                    auto done = step(seg.recorder, seg.indic_idx, i);
+                    if (done!=action::none) seg.events.emplace_back(trade_event{i, done});
+                }
+            }
+
+            std::vector<trade_event> events{std::move(segments.front().events)};
+            recorder_type actual{std::move(segments.front().recorder)};
+            std::size_t actual_idx{segments.front().indic_idx};
+
+            for (std::size_t k{1}; k<segments.size(); k++) {
+                auto& seg = segments[k];
+                std::size_t next_event{0}, spec_level{0};
+                bool met = actual.next_entry_level()==spec_level;
+
+                // the indicators are the same, so the states meet once the next entry levels are equal
+                for (index_t i{k*length}; !met && i<std::min(size, (k+1)*length); i++) {
+                    auto done = step(actual, actual_idx, i);
+                    if (done!=action::none) events.emplace_back(trade_event{i, done});
+
+                    for (; next_event<seg.events.size() && seg.events[next_event].tick<=i; next_event++)
+                        spec_level = (seg.events[next_event].done==action::opened) ? spec_level+1 : 0;
+                    met = actual.next_entry_level()==spec_level;
+                }
+
+                if (met) {
+                    events.insert(events.end(), seg.events.begin()+next_event, seg.events.end());
+                    actual = std::move(seg.recorder);
+                    actual_idx = seg.indic_idx;
+                }
+            }
+            return events;
+        }
+
+        std::size_t segment_count() const
+        {
+            return segment_count_;
+        }
+    };
+}
+
+#endif //BACKTESTING_BAZOOKA_SEGMENTED_RECORDER_HPP
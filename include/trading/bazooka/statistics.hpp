@@ -6,11 +6,32 @@
 #define BACKTESTING_BAZOOKA_STATISTICS_HPP
 
 #include <array>
+#include <ctime>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
 #include <trading/statistics.hpp>
 #include <trading/action.hpp>
 #include <trading/data_point.hpp>
 
 namespace trading::bazooka {
+    template<std::size_t n_levels>
+    class statistics;
+
+    template<std::size_t n_levels>
+    struct window_statistics {
+        std::time_t from;
+        statistics<n_levels> stats;
+    };
+
+    // global statistics and statistics of each window
+    template<std::size_t n_levels>
+    struct windowed_statistics {
+        statistics<n_levels> total;
+        std::vector<window_statistics<n_levels>> windows;
+    };
+
     template<std::size_t n_levels>
     class statistics : public trading::statistics {
         std::array<std::size_t, n_levels> open_order_counts_;
@@ -31,6 +52,25 @@ namespace trading::bazooka {
             return open_order_counts_;
         }
 
+    private:
+        template<class Trader>
+        static void update(statistics& stats, const Trader& trader, const trading::action& action,
+                const price_point& curr)
+        {
+            if (action==action::closed_all) {
+                stats.update_close_balance(trader.wallet_balance());
+                stats.update_equity(trader.equity(curr.data));
+                stats.update_profit(trader.last_closed_position().template total_realized_profit<amount>());
+                stats.increase_total_close_all_order_count();
+            }
+            else if (action==action::opened) {
+                stats.increase_open_order_count(trader.next_entry_level()-1);
+                stats.increase_total_open_order_count();
+            }
+        }
+
+    public:
+
         class collector {
             bazooka::statistics<n_levels> stats_;
 
@@ -44,16 +84,7 @@ namespace trading::bazooka {
             template<class Trader>
             void decided(const Trader& trader, const trading::action& action, const price_point& curr)
             {
-                if (action==action::closed_all) {
-                    stats_.update_close_balance(trader.wallet_balance());
-                    stats_.update_equity(trader.equity(curr.data));
-                    stats_.update_profit(trader.last_closed_position().template total_realized_profit<amount>());
-                    stats_.increase_total_close_all_order_count();
-                }
-                else if (action==action::opened) {
-                    stats_.increase_open_order_count(trader.next_entry_level()-1);
-                    stats_.increase_total_open_order_count();
-                }
+                update(stats_, trader, action, curr);
             }
 
             template<class Trader>
@@ -76,6 +107,85 @@ namespace trading::bazooka {
                 return stats_;
             }
         };
+
+        // Collects the statistics of the time windows starting at the boundaries alongside the global ones.
+        // The last window is open-ended and the ticks before the first boundary belong to no window.
+        // The windows open and close at the equity, so a position held over a boundary is valued at the market
+        // price in both windows, while its trade is counted in the window it was closed in.
+        // A window closes after the decision of the first tick at or past its end, so a trade decided on a boundary
+        // is counted in the window whose equity it changed and the next window opens at the equity after it.
+        class windowed_collector {
+            collector total_;
+            std::vector<std::time_t> boundaries_;
+            std::vector<window_statistics<n_levels>> windows_;
+            std::size_t next_{0};
+
+            static std::vector<std::time_t> validate_boundaries(std::vector<std::time_t>&& boundaries)
+            {
+                if (boundaries.empty())
+                    throw std::invalid_argument("At least one window boundary has to be provided");
+                if (std::adjacent_find(boundaries.begin(), boundaries.end(), std::greater_equal<>{})!=boundaries.end())
+                    throw std::invalid_argument("Window boundaries have to be strictly increasing");
+                return boundaries;
+            }
+
+            template<class Trader>
+            bazooka::statistics<n_levels>* current(const Trader& trader, const price_point& curr)
+            {
+                for (; next_<boundaries_.size() && curr.time>=boundaries_[next_]; next_++) {
+                    if (!windows_.empty()) windows_.back().stats.final_balance(trader.equity(curr.data));
+                    windows_.emplace_back(window_statistics<n_levels>{boundaries_[next_],
+                                                 bazooka::statistics<n_levels>(trader.equity(curr.data))});
+                }
+                return windows_.empty() ? nullptr : &windows_.back().stats;
+            }
+
+        public:
+            explicit windowed_collector(std::vector<std::time_t> boundaries)
+                    :boundaries_(validate_boundaries(std::move(boundaries)))
+            {
+                windows_.reserve(boundaries_.size());
+            }
+
+            template<class Trader>
+            void started(const Trader& trader, const price_point& first)
+            {
+                total_.started(trader, first);
+                windows_.clear();
+                next_ = 0;
+                current(trader, first);
+            }
+
+            template<class Trader>
+            void decided(const Trader& trader, const trading::action& action, const price_point& curr)
+            {
+                total_.decided(trader, action, curr);
+                if (!windows_.empty()) update(windows_.back().stats, trader, action, curr);
+                current(trader, curr);
+            }
+
+            template<class Trader>
+            void position_active(const Trader& trader, const price_point& curr)
+            {
+                total_.position_active(trader, curr);
+                if (auto stats = current(trader, curr)) stats->update_equity(trader.equity(curr.data));
+            }
+
+            template<class Trader>
+            void indicators_updated(const Trader&, const price_point&) { }
+
+            template<class Trader>
+            void finished(const Trader& trader, const price_point& last)
+            {
+                total_.finished(trader, last);
+                if (!windows_.empty()) windows_.back().stats.final_balance(trader.equity(last.data));
+            }
+
+            windowed_statistics<n_levels> get() const
+            {
+                return windowed_statistics<n_levels>{total_.get(), windows_};
+            }
+        };
     };
 }
 #endif //BACKTESTING_BAZOOKA_STATISTICS_HPP
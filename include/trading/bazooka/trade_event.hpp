@@ -0,0 +1,20 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_BAZOOKA_TRADE_EVENT_HPP
+#define BACKTESTING_BAZOOKA_TRADE_EVENT_HPP
+
+#include <trading/types.hpp>
+#include <trading/action.hpp>
+
+namespace trading::bazooka {
+    struct trade_event {
+        index_t tick;
+        action done;
+
+        bool operator==(const trade_event& rhs) const = default;
+    };
+}
+
+#endif //BACKTESTING_BAZOOKA_TRADE_EVENT_HPP
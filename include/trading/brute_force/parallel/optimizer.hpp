@@ -5,39 +5,150 @@
 #ifndef BACKTESTING_PARALLEL_BRUTE_FORCE_OPTIMIZER_HPP
 #define BACKTESTING_PARALLEL_BRUTE_FORCE_OPTIMIZER_HPP
 
+#include <mutex>
+#include <atomic>
+#include <ranges>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
 #include <functional>
+#include <type_traits>
 #include <cppcoro/generator.hpp>
 #include <trading/statistics.hpp>
 #include <trading/interface.hpp>
 
 
 namespace trading::brute_force::parallel {
+    // Workers claim chunks of the search space and keep their own copy of the result,
+    // the copies that were updated are merged into the result once at the end. With a random access search space
+    // the chunks are index ranges claimed without a lock, a generated one is read in chunks under a lock.
     template<class State>
-    struct optimizer {
+    class optimizer {
         using state_t = State;
         using config_t = typename state_t::config_type;
 
+        template<class Result>
+        struct alignas(64) worker {
+            Result result;
+            bool updated{false};
+        };
+
+        std::size_t thread_count_, chunk_size_;
+
+        static std::size_t validate_thread_count(std::size_t thread_count)
+        {
+            if (!thread_count)
+                throw std::invalid_argument("Thread count has to be greater than zero");
+            return thread_count;
+        }
+
+        static std::size_t validate_chunk_size(std::size_t chunk_size)
+        {
+            if (!chunk_size)
+                throw std::invalid_argument("Chunk size has to be greater than zero");
+            return chunk_size;
+        }
+
+        template<class Result>
+        std::vector<worker<Result>> create_workers(const Result& result) const
+        {
+            std::vector<worker<Result>> workers;
+            workers.reserve(thread_count_);
+            for (std::size_t w{0}; w<thread_count_; w++)
+                workers.emplace_back(worker<Result>{result});
+            return workers;
+        }
+
+        template<class Result>
+        static void evaluate(worker<Result>& curr, const config_t& config, auto&& constraints, auto&& objective)
+        {
+            auto state = objective(config);
+            if (constraints(state)) {
+                curr.result.update(state);
+                curr.updated = true;
+            }
+        }
+
+        template<class Result>
+        static void merge(Result& result, const std::vector<worker<Result>>& workers)
+        {
+            for (const auto& curr: workers) {
+                if (!curr.updated) continue;
+
+                if constexpr (std::ranges::range<decltype(curr.result.get())>)
+                    for (const auto& state: curr.result.get())
+                        result.update(state);
+                else
+                    result.update(curr.result.get());
+            }
+        }
+
+    public:
+        explicit optimizer(std::size_t thread_count = std::max(1U, std::thread::hardware_concurrency()),
+                std::size_t chunk_size = 1'024)
+                :thread_count_(validate_thread_count(thread_count)), chunk_size_(validate_chunk_size(chunk_size)) { }
+
+        // the workers start from copies of the result, so it should not contain states of the search space yet
         void operator()(IResult<state_t> auto& result,
                 IConstraints<state_t> auto&& constraints,
                 IObjectiveFunction<state_t> auto&& objective,
                 ISearchSpace<config_t> auto&& search_space) const
         {
-            #pragma omp parallel
-            {
-                #pragma omp single
-                {
-                    for (const config_t& config: search_space()) {
-                        #pragma omp task
-                        {
-                            auto state = objective(config);
-                            if (constraints(state)) {
-                                #pragma omp critical
-                                result.update(state);
-                            }
-                        }
+            auto workers = create_workers(result);
+            auto configs = search_space();
+            auto it = configs.begin();
+            std::mutex mutex;
+
+            #pragma omp parallel for num_threads(thread_count_) schedule(static, 1)
+            for (std::size_t w = 0; w<thread_count_; w++) {
+                std::vector<config_t> chunk;
+                chunk.reserve(chunk_size_);
+
+                while (true) {
+                    chunk.clear();
+                    {
+                        std::lock_guard lock{mutex};
+                        for (; it!=configs.end() && chunk.size()<chunk_size_; ++it)
+                            chunk.emplace_back(*it);
                     }
+                    if (chunk.empty()) break;
+
+                    for (const auto& config: chunk)
+                        evaluate(workers[w], config, constraints, objective);
                 }
             }
+            merge(result, workers);
+        }
+
+        void operator()(IResult<state_t> auto& result,
+                IConstraints<state_t> auto&& constraints,
+                IObjectiveFunction<state_t> auto&& objective,
+                IRandomAccessSearchSpace<config_t> auto&& search_space) const
+        {
+            auto workers = create_workers(result);
+            const std::size_t size = search_space.size();
+            std::atomic<std::size_t> next{0};
+
+            #pragma omp parallel for num_threads(thread_count_) schedule(static, 1)
+            for (std::size_t w = 0; w<thread_count_; w++) {
+                for (std::size_t begin; (begin = next.fetch_add(chunk_size_))<size;) {
+                    std::size_t end = std::min(begin+chunk_size_, size);
+                    for (std::size_t i{begin}; i<end; i++)
+                        evaluate(workers[w], search_space.at(i), constraints, objective);
+                }
+            }
+            merge(result, workers);
+        }
+
+        std::size_t thread_count() const
+        {
+            return thread_count_;
+        }
+
+        std::size_t chunk_size() const
+        {
+            return chunk_size_;
         }
     };
 }
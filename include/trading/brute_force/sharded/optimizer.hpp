@@ -0,0 +1,275 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_SHARDED_BRUTE_FORCE_OPTIMIZER_HPP
+#define BACKTESTING_SHARDED_BRUTE_FORCE_OPTIMIZER_HPP
+
+#include <string>
+#include <ranges>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <system_error>
+#include <stdexcept>
+#include <filesystem>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <trading/interface.hpp>
+#include <trading/brute_force/parallel/optimizer.hpp>
+
+namespace trading::brute_force::sharded {
+    // Splits the search space into numbered shards of consecutive indices, that are evaluated by worker processes
+    // sharing a directory. Worker i of n handles the shards s with s%n==i. The best configurations of each shard
+    // are written to a file followed by a completion marker, so a restarted worker skips the completed shards.
+    // Only the configurations are stored, the merge evaluates them again. A manifest of the search space size,
+    // the shard size and the hash of the settings is kept in the directory, so shards of a different run are refused.
+    // The workers finding all the shards completed claim the merge, only the one creating the lock merges them.
+    template<class State>
+    class optimizer {
+        using state_t = State;
+        using config_t = typename state_t::config_type;
+
+        template<class SearchSpace>
+        struct shard_view {
+            const SearchSpace& search_space;
+            std::size_t begin, end;
+
+            std::size_t size() const
+            {
+                return end-begin;
+            }
+
+            decltype(auto) at(std::size_t index) const
+            {
+                return search_space.at(begin+index);
+            }
+        };
+
+        std::filesystem::path dir_;
+        std::size_t shard_size_, worker_index_, worker_count_;
+        std::uint64_t settings_hash_;
+        parallel::optimizer<state_t> evaluate_;
+
+        static std::size_t validate_shard_size(std::size_t shard_size)
+        {
+            if (!shard_size)
+                throw std::invalid_argument("Shard size has to be greater than zero");
+            return shard_size;
+        }
+
+        static std::size_t validate_worker_count(std::size_t worker_count)
+        {
+            if (!worker_count)
+                throw std::invalid_argument("Worker count has to be greater than zero");
+            return worker_count;
+        }
+
+        static std::size_t validate_worker_index(std::size_t worker_index, std::size_t worker_count)
+        {
+            if (worker_index>=worker_count)
+                throw std::invalid_argument("Worker index has to be less than worker count");
+            return worker_index;
+        }
+
+        // FNV-1a, it is the same in every process unlike std::hash
+        static std::uint64_t hash(const std::string& settings)
+        {
+            std::uint64_t value{0xcbf29ce484222325};
+            for (unsigned char c: settings)
+                value = (value^c)*0x100000001b3;
+            return value;
+        }
+
+        std::filesystem::path manifest_path() const
+        {
+            return dir_/"manifest.json";
+        }
+
+        nlohmann::json manifest(std::size_t size) const
+        {
+            return nlohmann::json{
+                    {"size", size},
+                    {"shard size", shard_size_},
+                    {"settings hash", fmt::format("{:016x}", settings_hash_)}
+            };
+        }
+
+        // writes the manifest of the first run, the later runs have to match it
+        void check_manifest(std::size_t size) const
+        {
+            auto expect = manifest(size);
+            if (!std::filesystem::exists(manifest_path())) {
+                write(manifest_path(), expect.dump());
+                return;
+            }
+
+            std::ifstream file{manifest_path()};
+            if (nlohmann::json::parse(file)!=expect)
+                throw std::runtime_error(fmt::format("Shards in {} belong to a run with a different search space "
+                                                     "size, shard size or settings", dir_.string()));
+        }
+
+        std::filesystem::path states_path(std::size_t shard) const
+        {
+            return dir_/fmt::format("shard-{}.json", shard);
+        }
+
+        std::filesystem::path marker_path(std::size_t shard) const
+        {
+            return dir_/fmt::format("shard-{}.done", shard);
+        }
+
+        std::filesystem::path merge_lock_path() const
+        {
+            return dir_/"merge.lock";
+        }
+
+        // the content is written to a file of the worker first
+        std::filesystem::path write_temp(const std::filesystem::path& path, const std::string& content) const
+        {
+            auto temp_path = path;
+            temp_path += fmt::format(".{}.tmp", worker_index_);
+            std::ofstream file{temp_path, std::ios::trunc};
+            file << content;
+            if (!file.flush())
+                throw std::runtime_error("Cannot write "+temp_path.string());
+            return temp_path;
+        }
+
+        // the temporary file is renamed, so the other processes never see a partially written file
+        void write(const std::filesystem::path& path, const std::string& content) const
+        {
+            std::filesystem::rename(write_temp(path, content), path);
+        }
+
+    public:
+        // the settings describe everything else the shards depend on, such as the objective
+        optimizer(std::filesystem::path dir, std::size_t shard_size, std::size_t worker_index = 0,
+                std::size_t worker_count = 1, const std::string& settings = "",
+                parallel::optimizer<state_t> evaluate = parallel::optimizer<state_t>{})
+                :dir_(std::move(dir)), shard_size_(validate_shard_size(shard_size)),
+                 worker_index_(validate_worker_index(worker_index, validate_worker_count(worker_count))),
+                 worker_count_(worker_count), settings_hash_(hash(settings)), evaluate_(evaluate)
+        {
+            std::filesystem::create_directories(dir_);
+        }
+
+        // evaluates the shards of the worker, that are not completed yet, each into a copy of the result,
+        // returns the number of evaluated shards
+        std::size_t operator()(const IResult<state_t> auto& result,
+                IConstraints<state_t> auto&& constraints,
+                IObjectiveFunction<state_t> auto&& objective,
+                IRandomAccessSearchSpace<config_t> auto&& search_space) const
+        {
+            using search_space_t = std::remove_cvref_t<decltype(search_space)>;
+            const std::size_t size = search_space.size();
+            std::size_t evaluated_count{0};
+            check_manifest(size);
+
+            for (std::size_t shard{worker_index_}; shard<shard_count(size); shard += worker_count_) {
+                if (completed(shard)) continue;
+
+                auto shard_result = result;
+                std::size_t begin{shard*shard_size_};
+                shard_view<search_space_t> view{search_space, begin, std::min(begin+shard_size_, size)};
+                evaluate_(shard_result, constraints, objective, view);
+
+                nlohmann::json configs = nlohmann::json::array();
+                if constexpr (std::ranges::range<decltype(shard_result.get())>)
+                    for (const auto& state: shard_result.get())
+                        configs.emplace_back(state.config);
+                else
+                    configs.emplace_back(shard_result.get().config);
+
+                write(states_path(shard), configs.dump());
+                write(marker_path(shard), "");
+                evaluated_count++;
+            }
+            return evaluated_count;
+        }
+
+        // merges the best configurations of all shards into the result,
+        // throws without changing the result when a shard is not completed
+        void merge(IResult<state_t> auto& result,
+                IConstraints<state_t> auto&& constraints,
+                IObjectiveFunction<state_t> auto&& objective,
+                std::size_t size) const
+        {
+            check_manifest(size);
+            for (std::size_t shard{0}; shard<shard_count(size); shard++)
+                if (!completed(shard))
+                    throw std::runtime_error(fmt::format("Shard {} is not completed", shard));
+
+            for (std::size_t shard{0}; shard<shard_count(size); shard++) {
+                std::ifstream file{states_path(shard)};
+                for (const auto& config: nlohmann::json::parse(file)) {
+                    auto state = objective(config.template get<config_t>());
+                    if (constraints(state))
+                        result.update(state);
+                }
+            }
+        }
+
+        // the lock holding the index of the worker is linked to its temporary file, which fails when it exists,
+        // so exactly one worker claims the merge, the claiming worker claims it again when it is restarted
+        bool claim_merge() const
+        {
+            auto temp_path = write_temp(merge_lock_path(), std::to_string(worker_index_));
+            std::error_code error;
+            std::filesystem::create_hard_link(temp_path, merge_lock_path(), error);
+            std::filesystem::remove(temp_path);
+            if (error && error!=std::errc::file_exists)
+                throw std::filesystem::filesystem_error("Cannot claim the merge", merge_lock_path(), error);
+            return merge_owner()==worker_index_;
+        }
+
+        // index of the worker, that claimed the merge
+        std::optional<std::size_t> merge_owner() const
+        {
+            std::ifstream file{merge_lock_path()};
+            std::size_t worker_index;
+            if (!(file >> worker_index)) return std::nullopt;
+            return worker_index;
+        }
+
+        std::size_t shard_count(std::size_t size) const
+        {
+            return (size+shard_size_-1)/shard_size_;
+        }
+
+        bool completed(std::size_t shard) const
+        {
+            return std::filesystem::exists(marker_path(shard));
+        }
+
+        bool completed_all(std::size_t size) const
+        {
+            for (std::size_t shard{0}; shard<shard_count(size); shard++)
+                if (!completed(shard)) return false;
+            return true;
+        }
+
+        const std::filesystem::path& directory() const
+        {
+            return dir_;
+        }
+
+        std::size_t shard_size() const
+        {
+            return shard_size_;
+        }
+
+        std::size_t worker_index() const
+        {
+            return worker_index_;
+        }
+
+        std::size_t worker_count() const
+        {
+            return worker_count_;
+        }
+    };
+}
+
+#endif //BACKTESTING_SHARDED_BRUTE_FORCE_OPTIMIZER_HPP
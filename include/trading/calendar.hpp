@@ -0,0 +1,39 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_CALENDAR_HPP
+#define BACKTESTING_CALENDAR_HPP
+
+#include <ctime>
+#include <chrono>
+#include <vector>
+#include <stdexcept>
+
+namespace trading {
+    // UTC starts of every n-th month from the month containing from up to to
+    inline std::vector<std::time_t> monthly_boundaries(std::time_t from, std::time_t to, unsigned n_months = 1)
+    {
+        using namespace std::chrono;
+        if (!n_months)
+            throw std::invalid_argument("The number of months has to be greater than zero");
+
+        year_month_day first{floor<days>(system_clock::from_time_t(from))};
+        year_month curr{first.year(), first.month()};
+        std::vector<std::time_t> boundaries;
+
+        for (std::time_t start; (start = system_clock::to_time_t(sys_days{curr/1}))<=to; curr += months{n_months})
+            boundaries.emplace_back(start);
+        return boundaries;
+    }
+
+    // UTC starts of every year from the year containing from up to to
+    inline std::vector<std::time_t> yearly_boundaries(std::time_t from, std::time_t to)
+    {
+        using namespace std::chrono;
+        year_month_day first{floor<days>(system_clock::from_time_t(from))};
+        return monthly_boundaries(system_clock::to_time_t(sys_days{first.year()/January/1}), to, 12);
+    }
+}
+
+#endif //BACKTESTING_CALENDAR_HPP
@@ -17,8 +17,16 @@ namespace trading {
         price_t open_{min_price}, high_{min_price}, low_{min_price}, close_{min_price};
 
     public:
+        // tag of the constructor that skips validation, for already validated data
+        struct trusted_t {
+        };
+        static constexpr trusted_t trusted{};
+
         candle() = default;
 
+        constexpr candle(trusted_t, std::time_t opened, price_t open, price_t high, price_t low, price_t close)
+                :opened_(opened), open_(open), high_(high), low_(low), close_(close) { }
+
         constexpr candle(std::time_t opened, price_t open, price_t high, price_t low, price_t close)
                 :opened_(opened), open_(open), high_(high), low_(low), close_(close)
         {
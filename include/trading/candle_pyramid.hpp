@@ -0,0 +1,160 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_CANDLE_PYRAMID_HPP
+#define BACKTESTING_CANDLE_PYRAMID_HPP
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <algorithm>
+#include <vector>
+#include <unordered_map>
+#include <fmt/format.h>
+#include <trading/types.hpp>
+#include <trading/candle.hpp>
+#include <trading/time_resampler.hpp>
+
+namespace trading {
+    struct timeframe {
+        std::time_t period;
+        std::vector<candle> candles;
+        std::vector<index_t> ends;  // index of the last base candle of each candle
+
+        std::size_t memory() const
+        {
+            return candles.capacity()*sizeof(candle)+ends.capacity()*sizeof(index_t);
+        }
+    };
+
+    // Caches timeframes of one currency pair. A timeframe is built lazily on the first request
+    // from the coarsest already built timeframe whose period divides its period, otherwise from the base candles.
+    // Least recently used timeframes are evicted to keep the cache within the memory budget (in bytes).
+    class candle_pyramid {
+        std::vector<candle> base_;
+        std::time_t candle_period_, offset_;
+        std::size_t memory_budget_, memory_{0};
+
+        struct entry {
+            std::shared_ptr<const timeframe> frame;
+            std::size_t last_used;
+        };
+
+        std::unordered_map<std::time_t, entry> frames_;
+        std::size_t clock_{0};
+        mutable std::mutex mutex_;
+
+        std::shared_ptr<const timeframe> find_source(std::time_t period) const
+        {
+            std::shared_ptr<const timeframe> source;
+            for (const auto& [finer_period, finer]: frames_)
+                if (finer_period<period && period%finer_period==0 && (!source || finer_period>source->period))
+                    source = finer.frame;
+            return source;
+        }
+
+        std::shared_ptr<const timeframe> build(std::time_t period) const
+        {
+            auto frame = std::make_shared<timeframe>();
+            frame->period = period;
+            auto source = find_source(period);
+
+            if (source) {
+                auto resampled = time_resampler{period, source->period, offset_}(source->candles);
+                frame->candles.reserve(resampled.size());
+                frame->ends.reserve(resampled.size());
+
+                for (const auto& bucket: resampled) {
+                    frame->candles.emplace_back(bucket.value);
+                    frame->ends.emplace_back(source->ends[bucket.last]);
+                }
+            }
+            else {
+                auto resampled = time_resampler{period, candle_period_, offset_}(base_);
+                frame->candles.reserve(resampled.size());
+                frame->ends.reserve(resampled.size());
+
+                for (const auto& bucket: resampled) {
+                    frame->candles.emplace_back(bucket.value);
+                    frame->ends.emplace_back(bucket.last);
+                }
+            }
+            return frame;
+        }
+
+        void make_space(std::size_t required)
+        {
+            if (required>memory_budget_)
+                throw std::runtime_error(
+                        fmt::format("Timeframe of {} B does not fit into memory budget of {} B", required,
+                                memory_budget_));
+
+            while (memory_+required>memory_budget_) {
+                auto lru = std::min_element(frames_.begin(), frames_.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.second.last_used<rhs.second.last_used;
+                });
+                memory_ -= lru->second.frame->memory();
+                frames_.erase(lru);
+            }
+        }
+
+    public:
+        explicit candle_pyramid(std::vector<candle> base, std::size_t memory_budget, std::time_t candle_period = 60,
+                std::time_t offset = 0)
+                :base_(std::move(base)), candle_period_(candle_period), offset_(offset),
+                 memory_budget_(memory_budget) { }
+
+        // Returns the timeframe, building it first if it is not cached.
+        // The timeframe stays valid as long as it is referenced, even after eviction.
+        std::shared_ptr<const timeframe> operator()(std::time_t period)
+        {
+            std::lock_guard lock{mutex_};
+            auto it = frames_.find(period);
+            if (it!=frames_.end()) {
+                it->second.last_used = ++clock_;
+                return it->second.frame;
+            }
+
+            auto frame = build(period);
+            make_space(frame->memory());
+            memory_ += frame->memory();
+            frames_.emplace(period, entry{frame, ++clock_});
+            return frame;
+        }
+
+        bool contains(std::time_t period) const
+        {
+            std::lock_guard lock{mutex_};
+            return frames_.contains(period);
+        }
+
+        const std::vector<candle>& base() const
+        {
+            return base_;
+        }
+
+        std::time_t candle_period() const
+        {
+            return candle_period_;
+        }
+
+        std::time_t offset() const
+        {
+            return offset_;
+        }
+
+        std::size_t memory() const
+        {
+            std::lock_guard lock{mutex_};
+            return memory_;
+        }
+
+        std::size_t memory_budget() const
+        {
+            return memory_budget_;
+        }
+    };
+}
+
+#endif //BACKTESTING_CANDLE_PYRAMID_HPP
@@ -0,0 +1,209 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_CANDLE_VALIDATOR_HPP
+#define BACKTESTING_CANDLE_VALIDATOR_HPP
+
+#include <map>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <trading/types.hpp>
+#include <trading/candle.hpp>
+
+namespace trading {
+    // candles stored by column, so they can be validated with vector instructions
+    struct candle_columns {
+        std::vector<std::time_t> opened;
+        std::vector<price_t> open, high, low, close;
+
+        void reserve(std::size_t size)
+        {
+            opened.reserve(size);
+            open.reserve(size);
+            high.reserve(size);
+            low.reserve(size);
+            close.reserve(size);
+        }
+
+        void emplace_back(std::time_t opened_val, price_t open_val, price_t high_val, price_t low_val,
+                price_t close_val)
+        {
+            opened.emplace_back(opened_val);
+            open.emplace_back(open_val);
+            high.emplace_back(high_val);
+            low.emplace_back(low_val);
+            close.emplace_back(close_val);
+        }
+
+        std::size_t size() const
+        {
+            return opened.size();
+        }
+    };
+
+    enum class cleaning_policy {
+        keep,   // rows are kept as they are, invalid prices throw on construction
+        drop,   // invalid, duplicate and out of order rows are dropped
+        repair, // high and low are widened to the open and close, duplicate and out of order rows are dropped
+    };
+
+    struct validation_report {
+        std::size_t count{0}, invalid_count{0}, duplicate_count{0}, unordered_count{0};
+        std::size_t dropped_count{0}, repaired_count{0};
+        std::map<std::time_t, std::size_t> gaps;  // gap length in seconds -> number of occurrences
+
+        bool valid() const
+        {
+            return !invalid_count && !duplicate_count && !unordered_count;
+        }
+    };
+
+    class candle_validator {
+        std::time_t candle_period_;
+        cleaning_policy policy_;
+
+        static std::time_t validate_candle_period(std::time_t candle_period)
+        {
+            if (candle_period<=0)
+                throw std::invalid_argument("Candle period has to be greater than 0");
+            return candle_period;
+        }
+
+        // non-zero for rows with prices out of the low-high range, NaN included
+        static std::vector<std::uint8_t> invalid_mask(const candle_columns& in, std::size_t& invalid_count)
+        {
+            const std::size_t size = in.size();
+            std::vector<std::uint8_t> invalid(size);
+            const price_t* open = in.open.data(), * high = in.high.data(), * low = in.low.data(),
+                    * close = in.close.data();
+            std::uint8_t* out = invalid.data();
+            std::size_t count{0};
+
+            #pragma omp simd reduction(+:count)
+            for (std::size_t i = 0; i<size; i++) {
+                bool valid = (low[i]<=open[i]) & (open[i]<=high[i]) & (low[i]<=close[i]) & (close[i]<=high[i]);
+                out[i] = !valid;
+                count += !valid;
+            }
+            invalid_count = count;
+            return invalid;
+        }
+
+        // latest time of the previous rows, the prefix maximum is computed as a vectorized scan
+        static std::vector<std::time_t> latest_times(const candle_columns& in)
+        {
+            const std::size_t size = in.size();
+            std::vector<std::time_t> latest(size);
+            const std::time_t* opened = in.opened.data();
+            std::time_t* out = latest.data();
+            std::time_t running = std::numeric_limits<std::time_t>::min();
+
+            #pragma omp simd reduction(inscan, max:running)
+            for (std::size_t i = 0; i<size; i++) {
+                out[i] = running;
+                #pragma omp scan exclusive(running)
+                running = std::max(running, opened[i]);
+            }
+            return latest;
+        }
+
+        // the rows are compared to the latest of the previous rows, so the rows after a jump back are counted
+        // as well and the gaps are measured in the ordered sequence, that the cleaning keeps
+        void check_order(const candle_columns& in, validation_report& report) const
+        {
+            const std::size_t size = in.size();
+            const std::time_t* opened = in.opened.data();
+            auto latest_vec = latest_times(in);
+            const std::time_t* latest = latest_vec.data();
+            std::size_t duplicate_count{0}, unordered_count{0};
+
+            #pragma omp simd reduction(+:duplicate_count, unordered_count)
+            for (std::size_t i = 1; i<size; i++) {
+                duplicate_count += opened[i]==latest[i];
+                unordered_count += opened[i]<latest[i];
+            }
+            report.duplicate_count = duplicate_count;
+            report.unordered_count = unordered_count;
+
+            for (std::size_t i{1}; i<size; i++)
+                if (opened[i]-latest[i]>candle_period_)
+                    report.gaps[opened[i]-latest[i]]++;
+        }
+
+    public:
+        explicit candle_validator(std::time_t candle_period = 60, cleaning_policy policy = cleaning_policy::drop)
+                :candle_period_(validate_candle_period(candle_period)), policy_(policy) { }
+
+        validation_report validate(const candle_columns& in) const
+        {
+            validation_report report;
+            report.count = in.size();
+            invalid_mask(in, report.invalid_count);
+            check_order(in, report);
+            return report;
+        }
+
+        // Cleans the candles according to the policy and fills in the report.
+        // Candles that passed the validation are constructed without further checks.
+        std::vector<candle> operator()(const candle_columns& in, validation_report& report) const
+        {
+            report = validation_report{};
+            report.count = in.size();
+            auto invalid = invalid_mask(in, report.invalid_count);
+            check_order(in, report);
+
+            std::vector<candle> out;
+            out.reserve(in.size());
+
+            if (policy_==cleaning_policy::keep) {
+                for (std::size_t i{0}; i<in.size(); i++)
+                    out.emplace_back(in.opened[i], in.open[i], in.high[i], in.low[i], in.close[i]);
+                return out;
+            }
+
+            for (std::size_t i{0}; i<in.size(); i++) {
+                if (!out.empty() && in.opened[i]<=out.back().opened()) {
+                    report.dropped_count++;
+                    continue;
+                }
+
+                if (!invalid[i]) {
+                    out.emplace_back(candle::trusted, in.opened[i], in.open[i], in.high[i], in.low[i], in.close[i]);
+                    continue;
+                }
+
+                price_t prices[]{in.open[i], in.high[i], in.low[i], in.close[i]};
+                bool finite = std::all_of(std::begin(prices), std::end(prices), [](price_t price) {
+                    return std::isfinite(price);
+                });
+
+                if (policy_==cleaning_policy::drop || !finite) {
+                    report.dropped_count++;
+                    continue;
+                }
+
+                auto [low, high] = std::minmax({in.open[i], in.high[i], in.low[i], in.close[i]});
+                out.emplace_back(candle::trusted, in.opened[i], in.open[i], high, low, in.close[i]);
+                report.repaired_count++;
+            }
+            return out;
+        }
+
+        std::time_t candle_period() const
+        {
+            return candle_period_;
+        }
+
+        cleaning_policy policy() const
+        {
+            return policy_;
+        }
+    };
+}
+
+#endif //BACKTESTING_CANDLE_VALIDATOR_HPP
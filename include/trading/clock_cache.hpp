@@ -0,0 +1,141 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_CLOCK_CACHE_HPP
+#define BACKTESTING_CLOCK_CACHE_HPP
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <optional>
+#include <stdexcept>
+#include <functional>
+#include <unordered_map>
+
+namespace trading {
+    // Map of a bounded size shared between threads. The keys are split into shards by their hash,
+    // each shard has its own lock and evicts with the CLOCK algorithm once full.
+    template<class Key, class Value, class Hash = std::hash<Key>>
+    class clock_cache {
+        struct slot {
+            Key key;
+            Value value;
+            bool referenced;
+        };
+
+        struct shard {
+            std::unordered_map<Key, std::size_t, Hash> indices;
+            std::vector<slot> slots;
+            std::size_t hand{0};
+            mutable std::mutex mutex;
+        };
+
+        Hash hash_;
+        std::size_t shard_capacity_;
+        std::vector<shard> shards_;
+        std::atomic<std::size_t> eviction_count_{0};
+
+        static std::size_t validate_capacity(std::size_t capacity)
+        {
+            if (!capacity)
+                throw std::invalid_argument("Capacity has to be greater than zero");
+            return capacity;
+        }
+
+        static std::size_t validate_shard_count(std::size_t shard_count)
+        {
+            if (!shard_count)
+                throw std::invalid_argument("Shard count has to be greater than zero");
+            return shard_count;
+        }
+
+        shard& shard_of(const Key& key)
+        {
+            return shards_[hash_(key)%shards_.size()];
+        }
+
+    public:
+        // the capacity is split evenly between the shards
+        explicit clock_cache(std::size_t capacity, std::size_t shard_count = 16)
+                :shard_capacity_((validate_capacity(capacity)+validate_shard_count(shard_count)-1)/shard_count),
+                 shards_(shard_count) { }
+
+        std::optional<Value> find(const Key& key)
+        {
+            auto& curr = shard_of(key);
+            std::lock_guard lock{curr.mutex};
+            auto it = curr.indices.find(key);
+            if (it==curr.indices.end()) return std::nullopt;
+
+            auto& found = curr.slots[it->second];
+            found.referenced = true;
+            return found.value;
+        }
+
+        // the referenced slots get a second chance, the first unreferenced one is replaced
+        void insert(const Key& key, const Value& value)
+        {
+            auto& curr = shard_of(key);
+            std::lock_guard lock{curr.mutex};
+            if (curr.indices.contains(key)) return;
+
+            if (curr.slots.size()<shard_capacity_) {
+                curr.indices.emplace(key, curr.slots.size());
+                curr.slots.emplace_back(slot{key, value, false});
+                return;
+            }
+
+            while (curr.slots[curr.hand].referenced) {
+                curr.slots[curr.hand].referenced = false;
+                curr.hand = (curr.hand+1)%curr.slots.size();
+            }
+            curr.indices.erase(curr.slots[curr.hand].key);
+            curr.slots[curr.hand] = slot{key, value, false};
+            curr.indices.emplace(key, curr.hand);
+            curr.hand = (curr.hand+1)%curr.slots.size();
+            eviction_count_++;
+        }
+
+        std::size_t eviction_count() const
+        {
+            return eviction_count_;
+        }
+
+        std::size_t size() const
+        {
+            std::size_t size{0};
+            for (const auto& curr: shards_) {
+                std::lock_guard lock{curr.mutex};
+                size += curr.slots.size();
+            }
+            return size;
+        }
+
+        std::size_t capacity() const
+        {
+            return shard_capacity_*shards_.size();
+        }
+
+        std::size_t shard_count() const
+        {
+            return shards_.size();
+        }
+
+        // estimated number of bytes taken by the slots and the indices
+        std::size_t memory() const
+        {
+            using node_type = typename decltype(shard::indices)::value_type;
+            std::size_t memory{shards_.size()*sizeof(shard)};
+            for (const auto& curr: shards_) {
+                std::lock_guard lock{curr.mutex};
+                memory += curr.slots.capacity()*sizeof(slot)+
+                        curr.indices.size()*(sizeof(node_type)+2*sizeof(void*))+
+                        curr.indices.bucket_count()*sizeof(void*);
+            }
+            return memory;
+        }
+    };
+}
+
+#endif //BACKTESTING_CLOCK_CACHE_HPP
@@ -81,6 +81,16 @@ namespace nlohmann {
         }
     };
 
+    template<std::size_t n_levels>
+    struct adl_serializer<trading::bazooka::windowed_statistics<n_levels>> {
+        static void to_json(nlohmann::json& j, const trading::bazooka::windowed_statistics<n_levels>& stats)
+        {
+            j = {{"total", stats.total}, {"windows", nlohmann::json::array()}};
+            for (const auto& window: stats.windows)
+                j["windows"].emplace_back(nlohmann::json{{"from", window.from}, {"statistics", window.stats}});
+        }
+    };
+
     template<>
     struct adl_serializer<trading::bazooka::indicator> {
         static void to_json(nlohmann::json& j, const trading::bazooka::indicator& indic)
@@ -104,6 +114,21 @@ namespace nlohmann {
                                 }}
             };
         }
+
+        static void from_json(const nlohmann::json& j, trading::bazooka::configuration<n_levels>& config)
+        {
+            const auto& type = j.at("indicator").at("type").get_ref<const std::string&>();
+            if (type=="sma")
+                config.tag = trading::bazooka::indicator_tag::sma;
+            else if (type=="ema")
+                config.tag = trading::bazooka::indicator_tag::ema;
+            else
+                throw std::invalid_argument(fmt::format("Unknown indicator type: {}", type));
+
+            config.period = j.at("indicator").at("period").get<std::size_t>();
+            config.levels = j.at("levels").get<std::array<trading::fraction_t, n_levels>>();
+            config.sizes = j.at("open sizes").get<std::array<trading::fraction_t, n_levels>>();
+        }
     };
 
     template<>
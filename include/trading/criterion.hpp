@@ -8,6 +8,10 @@
 #include <cmath>
 #include <cassert>
 #include <string>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <fmt/format.h>
 
 namespace trading {
     struct prom_criterion {
@@ -35,6 +39,47 @@ namespace trading {
             return "prom";
         }
     };
+
+    struct phase_summary {
+        double mean, worst, deviation;
+    };
+
+    inline phase_summary summarize(const std::vector<double>& values)
+    {
+        assert(!values.empty());
+        double mean = std::accumulate(values.begin(), values.end(), 0.0)/values.size();
+        double sq_sum{0};
+        for (const auto& val: values)
+            sq_sum += (val-mean)*(val-mean);
+        return phase_summary{mean, *std::min_element(values.begin(), values.end()), std::sqrt(sq_sum/values.size())};
+    }
+
+    // Combines the criterion of all resampling phases, penalizing the worst phase and the dispersion.
+    template<class Criterion>
+    struct phase_criterion {
+        Criterion criterion;
+        double worst_weight{0.5}, deviation_weight{1.0};
+
+        template<class Statistics>
+        double operator()(const std::vector<Statistics>& phase_stats) const
+        {
+            std::vector<double> values;
+            values.reserve(phase_stats.size());
+            for (const auto& stats: phase_stats)
+                values.emplace_back(criterion(stats));
+            return (*this)(summarize(values));
+        }
+
+        double operator()(const phase_summary& summary) const
+        {
+            return (1-worst_weight)*summary.mean+worst_weight*summary.worst-deviation_weight*summary.deviation;
+        }
+
+        static std::string name()
+        {
+            return fmt::format("phase {}", Criterion::name());
+        }
+    };
 }
 
 #endif //BACKTESTING_CRITERION_HPP
@@ -0,0 +1,104 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_EQUIVALENCE_HPP
+#define BACKTESTING_EQUIVALENCE_HPP
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <iostream>
+#include <type_traits>
+#include <trading/clock_cache.hpp>
+#include <trading/iteration_reporter.hpp>
+
+namespace trading {
+    // Wraps an objective function, configurations with the same behavioral key are answered
+    // from the state of the first evaluated one instead of being evaluated again.
+    // The states are kept in a clock_cache, so the least recently used keys are evaluated again.
+    // It can be shared between threads.
+    template<class State, class Objective, class KeyFunction>
+    class equivalent_objective {
+        using config_type = typename State::config_type;
+        using key_type = std::invoke_result_t<KeyFunction&, const config_type&>;
+
+        Objective objective_;
+        KeyFunction key_;
+        clock_cache<key_type, State> states_;
+        std::atomic<std::size_t> evaluated_count_{0}, avoided_count_{0};
+
+    public:
+        // the capacity is split evenly between the shards
+        equivalent_objective(Objective objective, KeyFunction key, std::size_t capacity, std::size_t shard_count = 16)
+                :objective_(std::move(objective)), key_(std::move(key)), states_(capacity, shard_count) { }
+
+        State operator()(const config_type& config)
+        {
+            auto key = key_(config);
+            if (auto found = states_.find(key)) {
+                avoided_count_++;
+                found->config = config;
+                return *found;
+            }
+
+            State state = objective_(config);
+            evaluated_count_++;
+            states_.insert(key, state);
+            return state;
+        }
+
+        std::size_t evaluated_count() const
+        {
+            return evaluated_count_;
+        }
+
+        std::size_t avoided_count() const
+        {
+            return avoided_count_;
+        }
+
+        std::size_t size() const
+        {
+            return states_.size();
+        }
+
+        std::size_t capacity() const
+        {
+            return states_.capacity();
+        }
+
+        std::size_t eviction_count() const
+        {
+            return states_.eviction_count();
+        }
+
+        // estimated number of bytes taken by the states and the keys
+        std::size_t memory() const
+        {
+            return states_.memory();
+        }
+    };
+
+    // Observer of any optimizer, that reports the evaluations avoided by the equivalence after each iteration.
+    template<class Equivalent, class Logger>
+    class equivalence_reporter : public iteration_reporter<equivalence_reporter<Equivalent, Logger>> {
+        const Equivalent& equivalent_;
+        std::shared_ptr<Logger> logger_;
+
+    public:
+        equivalence_reporter(const Equivalent& equivalent, std::shared_ptr<Logger> logger)
+                :equivalent_(equivalent), logger_{std::move(logger)} { }
+
+        template<class Optimizer>
+        void report(const Optimizer& optimizer)
+        {
+            *logger_ << "it: " << optimizer.it()
+                     << ", evaluations avoided: " << equivalent_.avoided_count()
+                     << ", evaluated: " << equivalent_.evaluated_count()
+                     << ", equivalence memory: " << equivalent_.memory() << " B" << std::endl;
+        }
+    };
+}
+
+#endif //BACKTESTING_EQUIVALENCE_HPP
@@ -0,0 +1,110 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_EVALUATION_CACHE_HPP
+#define BACKTESTING_EVALUATION_CACHE_HPP
+
+#include <atomic>
+#include <memory>
+#include <iostream>
+#include <utility>
+#include <functional>
+#include <trading/clock_cache.hpp>
+#include <trading/iteration_reporter.hpp>
+
+namespace trading {
+    // Wraps an objective function and remembers the states of the recently evaluated configurations,
+    // so the duplicates produced by the optimizers are not evaluated again. The states are kept in a clock_cache.
+    // It can be shared between threads, the same configuration may be evaluated concurrently more than once.
+    template<class State, class Objective, class Hash = std::hash<typename State::config_type>>
+    class evaluation_cache {
+        using config_type = typename State::config_type;
+
+        Objective objective_;
+        clock_cache<config_type, State, Hash> states_;
+        std::atomic<std::size_t> hit_count_{0}, miss_count_{0};
+
+    public:
+        // the capacity is split evenly between the shards
+        evaluation_cache(Objective objective, std::size_t capacity, std::size_t shard_count = 16)
+                :objective_(std::forward<Objective>(objective)), states_(capacity, shard_count) { }
+
+        State operator()(const config_type& config)
+        {
+            if (auto found = states_.find(config)) {
+                hit_count_++;
+                return *found;
+            }
+
+            State state = objective_(config);
+            miss_count_++;
+            states_.insert(config, state);
+            return state;
+        }
+
+        std::size_t hit_count() const
+        {
+            return hit_count_;
+        }
+
+        std::size_t miss_count() const
+        {
+            return miss_count_;
+        }
+
+        std::size_t eviction_count() const
+        {
+            return states_.eviction_count();
+        }
+
+        double hit_ratio() const
+        {
+            std::size_t hits = hit_count_, total = hits+miss_count_;
+            return total ? static_cast<double>(hits)/static_cast<double>(total) : 0.0;
+        }
+
+        std::size_t size() const
+        {
+            return states_.size();
+        }
+
+        std::size_t capacity() const
+        {
+            return states_.capacity();
+        }
+
+        std::size_t shard_count() const
+        {
+            return states_.shard_count();
+        }
+
+        // estimated number of bytes taken by the slots and the indices
+        std::size_t memory() const
+        {
+            return states_.memory();
+        }
+    };
+
+    // Observer of any optimizer, that reports the hit ratio and the memory of the cache after each iteration.
+    template<class Cache, class Logger>
+    class evaluation_cache_reporter : public iteration_reporter<evaluation_cache_reporter<Cache, Logger>> {
+        const Cache& cache_;
+        std::shared_ptr<Logger> logger_;
+
+    public:
+        evaluation_cache_reporter(const Cache& cache, std::shared_ptr<Logger> logger)
+                :cache_(cache), logger_{std::move(logger)} { }
+
+        template<class Optimizer>
+        void report(const Optimizer& optimizer)
+        {
+            *logger_ << "it: " << optimizer.it()
+                     << ", cache hit ratio: " << cache_.hit_ratio()
+                     << ", cache size: " << cache_.size()
+                     << ", cache memory: " << cache_.memory() << " B" << std::endl;
+        }
+    };
+}
+
+#endif //BACKTESTING_EVALUATION_CACHE_HPP
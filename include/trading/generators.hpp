@@ -10,6 +10,7 @@
 #include <random>
 #include <utility>
 #include <tuple>
+#include <vector>
 #include <cppcoro/recursive_generator.hpp>
 #include <etl/flat_set.h>
 #include <fmt/format.h>
@@ -88,6 +89,16 @@ namespace trading {
         {
             return {lower_bound_.numerator()*unscaled_denom(), lower_bound_.denominator()*unscaled_denom()};
         }
+
+        // all fractions the levels are made of, from the closest to the baseline
+        std::vector<fraction_t> unique_levels() const
+        {
+            std::vector<fraction_t> levels;
+            levels.reserve(unique_count_);
+            for (std::size_t num{unique_count_}; num>0; num--)
+                levels.emplace_back(rescale(num));
+            return levels;
+        }
     };
 }
 
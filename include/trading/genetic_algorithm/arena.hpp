@@ -0,0 +1,128 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_GENETIC_ALGORITHM_ARENA_HPP
+#define BACKTESTING_GENETIC_ALGORITHM_ARENA_HPP
+
+#include <vector>
+#include <utility>
+#include <cassert>
+#include <cstddef>
+
+namespace trading::genetic_algorithm {
+    // Keeps the individuals in slots, with the genes, the fitness values and the whole states in separate arrays.
+    // The selection, matchmaking and replacement pass the indices of the slots, so a state is written once
+    // when it is evaluated and never copied afterwards. The slots left out of a generation are reused.
+    template<class State>
+    class arena {
+        using state_t = State;
+        using config_t = typename State::config_type;
+
+        std::vector<config_t> configs_;
+        std::vector<double> values_;
+        std::vector<state_t> states_;
+        std::vector<bool> used_, kept_;
+        std::vector<std::size_t> free_;
+
+    public:
+        // takes a slot for each individual, the indices of the slots replace the content of indices
+        void acquire(std::size_t count, std::vector<std::size_t>& indices)
+        {
+            indices.clear();
+            indices.reserve(count);
+            for (std::size_t i{0}; i<count; i++) {
+                std::size_t index;
+                if (free_.empty()) {
+                    index = states_.size();
+                    configs_.emplace_back();
+                    values_.emplace_back();
+                    states_.emplace_back();
+                    used_.emplace_back();
+                }
+                else {
+                    index = free_.back();
+                    free_.pop_back();
+                }
+                used_[index] = true;
+                indices.emplace_back(index);
+            }
+        }
+
+        // the distinct slots can be assigned in parallel
+        void assign(std::size_t index, state_t&& state)
+        {
+            assert(used_[index]);
+            configs_[index] = state.config;
+            values_[index] = state.value;
+            states_[index] = std::move(state);
+        }
+
+        // releases the slots, that are not in indices
+        void keep(const std::vector<std::size_t>& indices)
+        {
+            kept_.assign(states_.size(), false);
+            for (auto index: indices)
+                kept_[index] = true;
+
+            for (std::size_t index{0}; index<states_.size(); index++)
+                if (used_[index] && !kept_[index]) {
+                    used_[index] = false;
+                    free_.emplace_back(index);
+                }
+        }
+
+        void clear()
+        {
+            configs_.clear();
+            values_.clear();
+            states_.clear();
+            used_.clear();
+            free_.clear();
+        }
+
+        const config_t& config(std::size_t index) const
+        {
+            return configs_[index];
+        }
+
+        double value(std::size_t index) const
+        {
+            return values_[index];
+        }
+
+        const state_t& state(std::size_t index) const
+        {
+            return states_[index];
+        }
+
+        // number of the used slots
+        std::size_t size() const
+        {
+            return states_.size()-free_.size();
+        }
+
+        std::size_t slot_count() const
+        {
+            return states_.size();
+        }
+    };
+
+    // orders the slots of the arena by their states
+    template<class State, class Comparator>
+    class index_comparator {
+        const arena<State>& arena_;
+        Comparator comp_;
+
+    public:
+        index_comparator(const arena<State>& arena, Comparator comp)
+                :arena_(arena), comp_(std::move(comp)) { }
+
+        bool operator()(std::size_t lhs, std::size_t rhs) const
+        {
+            return comp_(arena_.state(lhs), arena_.state(rhs));
+        }
+    };
+}
+
+#endif //BACKTESTING_GENETIC_ALGORITHM_ARENA_HPP
@@ -10,26 +10,29 @@
 #include <cassert>
 #include <random>
 #include <cppcoro/generator.hpp>
+#include <trading/random/engine.hpp>
 
 namespace trading::genetic_algorithm {
     template<std::size_t n_parents_>
     class random_matchmaker {
-        std::mt19937 gen_{std::random_device{}()};
+        random::engine gen_;
         static_assert(n_parents_>0);
 
     public:
         static constexpr std::size_t n_parents = n_parents_;
 
-        template<class Individual>
-        cppcoro::generator<std::array<typename Individual::config_type, n_parents>> operator()(std::vector<Individual>& parents)
+        explicit random_matchmaker(random::engine gen = random::device_engine())
+                :gen_{gen} { }
+
+        cppcoro::generator<std::array<std::size_t, n_parents>> operator()(std::vector<std::size_t>& parents)
         {
             if (parents.size()<n_parents) co_return;
 
             std::shuffle(parents.begin(), parents.end(), gen_);
-            std::array<typename Individual::config_type, n_parents> match;
+            std::array<std::size_t, n_parents> match;
 
             for (std::size_t i{0}; i<parents.size(); i++) {
-                match[i%n_parents] = parents[i].config;
+                match[i%n_parents] = parents[i];
 
                 if (!((i+1)%n_parents)) co_yield match;
             }
@@ -6,62 +6,101 @@
 #define BACKTESTING_GENETIC_ALGORITHM_OPTIMIZER_HPP
 
 #include <vector>
+#include <ranges>
 #include <tuple>
 #include <type_traits>
 #include <array>
 #include <algorithm>
+#include <stdexcept>
 #include <cppcoro/generator.hpp>
 #include <trading/tuple.hpp>
 #include <trading/state.hpp>
 #include <trading/interface.hpp>
+#include <trading/genetic_algorithm/arena.hpp>
 
 namespace trading::genetic_algorithm {
+    // The genes of each generation are evaluated by the fitness in parallel, so it has to be thread safe.
+    // The genes are created and the states kept in the same order for any number of threads.
+    // The states are kept in an arena, the population and the parents are the indices of their slots.
     template<class State>
     class optimizer {
         using state_t = State;
         using config_t = typename State::config_type;
-        std::size_t it_{0};
-        std::vector<state_t> population_;
+        std::size_t it_{0}, thread_count_;
+        arena<state_t> arena_;
+        std::vector<std::size_t> population_, selected_, parents_, children_;
+        std::vector<double> fitness_;
+        std::vector<config_t> children_genes_;
+
+        static std::size_t validate_thread_count(std::size_t thread_count)
+        {
+            if (!thread_count)
+                throw std::invalid_argument("Thread count has to be greater than zero");
+            return thread_count;
+        }
+
+        void evaluate(const std::vector<config_t>& genes, auto&& fitness, std::vector<std::size_t>& indices)
+        {
+            arena_.acquire(genes.size(), indices);
+            #pragma omp parallel for num_threads(thread_count_) schedule(dynamic)
+            for (std::size_t i = 0; i<genes.size(); i++)
+                arena_.assign(indices[i], fitness(genes[i]));
+        }
 
     public:
+        explicit optimizer(std::size_t thread_count = 1)
+                :thread_count_(validate_thread_count(thread_count)) { }
+
         template<IResult<state_t> Result>
         void operator()(const std::vector<config_t>& init_genes,
                 Result& result,
                 IConstraints<state_t> auto&& constraints,
                 IObjectiveFunction<state_t> auto&& fitness,
                 IPopulationSizer auto&& size,
-                ISelection<state_t> auto&& select,
-                IMatchmaker<state_t> auto&& match,
+                ISelection auto&& select,
+                IMatchmaker auto&& match,
                 ICrossover<config_t> auto&& crossover,
                 IMutation<config_t> auto&& mutate,
-                IReplacement<state_t, typename Result::comparator_type> auto&& replace,
+                IReplacement<index_comparator<state_t, typename Result::comparator_type>> auto&& replace,
                 ITerminationCriteria<optimizer> auto&& terminate,
                 IObserver<optimizer> auto& ... observers)
         {
-            population_.clear(), population_.reserve(init_genes.size());
-            for (const auto& genes: init_genes)
-                population_.template emplace_back(fitness(genes));
+            constexpr std::size_t n_parents = std::remove_reference_t<decltype(match)>::n_parents;
+            index_comparator<state_t, typename Result::comparator_type> comp{arena_, result.comparator()};
+            arena_.clear();
+            evaluate(init_genes, fitness, population_);
 
-            std::vector<state_t> parents, children;
             (observers.started(*this), ...);
             for (; population_.size() && !terminate(*this); it_++) {
-                parents.clear();
-                select(size(population_.size()), population_, parents);
+                fitness_.clear();
+                for (auto index: population_)
+                    fitness_.emplace_back(arena_.value(index));
+                selected_.clear();
+                select(size(population_.size()), fitness_, selected_);
+                parents_.clear();
+                for (auto position: selected_)
+                    parents_.emplace_back(population_[position]);
 
                 // mate
-                children.clear();
-                for (const auto& mates: match(parents))
-                    for (auto&& genes: crossover(mates))
-                        children.template emplace_back(fitness(mutate(std::move(genes))));
+                children_genes_.clear();
+                for (const auto& mates: match(parents_)) {
+                    std::array<config_t, n_parents> genes;
+                    for (std::size_t i{0}; i<n_parents; i++)
+                        genes[i] = arena_.config(mates[i]);
+                    for (auto&& child: crossover(genes))
+                        children_genes_.emplace_back(mutate(std::move(child)));
+                }
+                evaluate(children_genes_, fitness, children_);
 
-                // replace
+                // replace, the slots of the individuals left out are reused by the next children
                 population_.clear();
-                replace(parents, children, result.comparator(), population_);
+                replace(parents_, children_, comp, population_);
+                arena_.keep(population_);
 
                 // update results
-                for (const auto& individual: population_)
-                    if (constraints(individual))
-                        result.update(individual);
+                for (auto index: population_)
+                    if (constraints(arena_.state(index)))
+                        result.update(arena_.state(index));
 
                 (observers.population_updated(*this), ...);
             };
@@ -73,9 +112,17 @@ namespace trading::genetic_algorithm {
             return it_;
         }
 
-        const auto& population() const
+        // states of the current population
+        auto population() const
+        {
+            return population_ | std::views::transform([this](std::size_t index) -> const state_t& {
+                return arena_.state(index);
+            });
+        }
+
+        std::size_t thread_count() const
         {
-            return population_;
+            return thread_count_;
         }
     };
 }
@@ -28,14 +28,15 @@ namespace trading::genetic_algorithm {
         template<class Optimizer>
         void population_updated(const Optimizer& optimizer)
         {
-            auto first_fitness = optimizer.population().front().value;
+            auto population = optimizer.population();
+            auto first_fitness = population.front().value;
             double sum{first_fitness}, best{first_fitness};
-            std::for_each(optimizer.population().begin(), optimizer.population().end(),
+            std::for_each(population.begin(), population.end(),
                     [&](const auto& individual) {
                         sum += individual.value;
                         best = std::max(best, individual.value);
                     });
-            double mean{sum/optimizer.population().size()};
+            double mean{sum/population.size()};
             trading::for_each(observers_, [&](auto& observer, std::size_t) {
                 observer.population_updated(optimizer, mean, best);
             });
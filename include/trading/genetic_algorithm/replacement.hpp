@@ -10,12 +10,11 @@
 #include <trading/interface.hpp>
 
 namespace trading::genetic_algorithm {
+    // the individuals are the indices of their slots in the arena
     struct en_block_replacement {
-        template<class Individual>
-        void operator()(std::vector<Individual>&, std::vector<Individual>& children,
-                const IComparator<Individual> auto&, std::vector<Individual>& next_generation)
+        void operator()(std::vector<std::size_t>&, std::vector<std::size_t>& children,
+                const IComparator<std::size_t> auto&, std::vector<std::size_t>& next_generation)
         {
-            next_generation.reserve(children.size());
             next_generation = children;
         }
     };
@@ -33,12 +32,12 @@ namespace trading::genetic_algorithm {
         explicit elitism_replacement(fraction_t elite_ratio)
                 :elite_ratio_(validate_elite_ratio(elite_ratio)) { }
 
-        template<class Individual>
-        void operator()(std::vector<Individual>& parents, std::vector<Individual>& children,
-                const IComparator<Individual> auto& comp, std::vector<Individual>& next_generation)
+        // only the elite is partitioned from the parents, it is not sorted
+        void operator()(std::vector<std::size_t>& parents, std::vector<std::size_t>& children,
+                const IComparator<std::size_t> auto& comp, std::vector<std::size_t>& next_generation)
         {
-            std::sort(parents.begin(), parents.end(), comp);
             std::size_t elite_count = parents.size()*fraction_cast<float>(elite_ratio_);
+            std::nth_element(parents.begin(), parents.begin()+elite_count, parents.end(), comp);
             next_generation.reserve(elite_count+children.size());
             next_generation.insert(next_generation.end(), parents.begin(), parents.begin()+elite_count);
             next_generation.insert(next_generation.end(), children.begin(), children.end());
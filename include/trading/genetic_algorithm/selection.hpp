@@ -9,28 +9,25 @@
 #include <random>
 #include <algorithm>
 #include <assert.h>
+#include <trading/random/engine.hpp>
 
 namespace trading::genetic_algorithm {
     class roulette_selection {
-        std::mt19937 gen_{std::random_device{}()};
+        random::engine gen_;
         std::discrete_distribution<std::size_t> distrib_;
         using distrib_param_type = std::discrete_distribution<std::size_t>::param_type;
         std::vector<double> fitness_values_;
 
     public:
-        // works only for maximization
-        template<class Individual>
-        void operator()(std::size_t select_count, const std::vector<Individual>& population, std::vector<Individual>& parents)
+        explicit roulette_selection(random::engine gen = random::device_engine())
+                :gen_{gen} { }
+
+        // works only for maximization, selects the positions of the individuals by their fitness
+        void operator()(std::size_t select_count, const std::vector<double>& fitness, std::vector<std::size_t>& parents)
         {
-            assert(population.size());
-            fitness_values_.clear();
-            fitness_values_.reserve(population.size());
-            double min_fitness{0};
-            std::for_each(population.begin(), population.end(), [&](const auto& individual) {
-                auto fitness = individual.value;
-                min_fitness = std::min(fitness, min_fitness);
-                fitness_values_.template emplace_back(fitness);
-            });
+            assert(fitness.size());
+            fitness_values_.assign(fitness.begin(), fitness.end());
+            double min_fitness = std::min(0.0, *std::min_element(fitness.begin(), fitness.end()));
 
             if (min_fitness<0)
                 std::transform(fitness_values_.begin(), fitness_values_.end(), fitness_values_.begin(),
@@ -41,7 +38,7 @@ namespace trading::genetic_algorithm {
             parents.reserve(select_count);
 
             for (std::size_t i{0}; i<select_count; i++)
-                parents.template emplace_back(population[distrib_(gen_)]);
+                parents.emplace_back(distrib_(gen_));
         }
     };
 }
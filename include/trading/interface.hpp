@@ -5,8 +5,13 @@
 #ifndef BACKTESTING_INTERFACE_HPP
 #define BACKTESTING_INTERFACE_HPP
 
+#include <array>
+#include <vector>
 #include <concepts>
+#include <type_traits>
+#include <cppcoro/generator.hpp>
 #include <trading/candle.hpp>
+#include <trading/random/engine.hpp>
 
 namespace trading {
     // inspired by: https://youtu.be/l6Y9PqyK1Mc
@@ -24,19 +29,21 @@ namespace trading {
                 std::same_as<std::array<Genes, Crossover::n_children>, std::invoke_result_t<Crossover,
                         const std::array<Genes, Crossover::n_parents>>>;
 
-        template<class Selection, class Individual>
+        // selects the positions of the parents by the fitness of the population
+        template<class Selection>
         concept ISelection =
-        std::invocable<Selection, std::size_t, const std::vector<Individual>&, std::vector<Individual>&>
-                && std::same_as<void, std::invoke_result_t<Selection, std::size_t, const std::vector<Individual>&, std::vector<Individual>&>>;
+        std::invocable<Selection, std::size_t, const std::vector<double>&, std::vector<std::size_t>&>
+                && std::same_as<void, std::invoke_result_t<Selection, std::size_t, const std::vector<double>&, std::vector<std::size_t>&>>;
 
-        template<class Replacement, class Individual, class Comparator>
+        // the individuals are passed as the indices of their slots in the arena
+        template<class Replacement, class Comparator>
         concept IReplacement =
-        std::invocable<Replacement, std::vector<Individual>&, std::vector<Individual>&, const Comparator&, std::vector<Individual>&>
-                && std::same_as<void, std::invoke_result_t<Replacement, std::vector<Individual>&, std::vector<Individual>&, const Comparator&, std::vector<Individual>&>>;
+        std::invocable<Replacement, std::vector<std::size_t>&, std::vector<std::size_t>&, const Comparator&, std::vector<std::size_t>&>
+                && std::same_as<void, std::invoke_result_t<Replacement, std::vector<std::size_t>&, std::vector<std::size_t>&, const Comparator&, std::vector<std::size_t>&>>;
 
-        template<class ConcreteMatchmaker, class Individual>
-        concept IMatchmaker = std::invocable<ConcreteMatchmaker, std::vector<Individual>&>
-                && std::same_as<cppcoro::generator<std::array<typename Individual::config_type, std::remove_reference_t<ConcreteMatchmaker>::n_parents>>, std::invoke_result_t<ConcreteMatchmaker, std::vector<Individual>&>>;
+        template<class ConcreteMatchmaker>
+        concept IMatchmaker = std::invocable<ConcreteMatchmaker, std::vector<std::size_t>&>
+                && std::same_as<cppcoro::generator<std::array<std::size_t, std::remove_reference_t<ConcreteMatchmaker>::n_parents>>, std::invoke_result_t<ConcreteMatchmaker, std::vector<std::size_t>&>>;
 
         template<class PopulationSizer>
         concept IPopulationSizer = std::invocable<PopulationSizer, std::size_t> &&
@@ -67,6 +74,11 @@ namespace trading {
         concept INeighbor = std::invocable<Neighbor, const Config&> &&
                 std::same_as<Config, std::invoke_result_t<Neighbor, const Config&>>;
 
+        // creates a neighbor drawing from the engine
+        template<class NeighborFactory, class Config>
+        concept INeighborFactory = std::invocable<NeighborFactory, random::engine> &&
+                INeighbor<std::invoke_result_t<NeighborFactory, random::engine>, Config>;
+
         template<class Observer, class Optimizer>
         concept IObserver = requires(Observer& observer, const Optimizer& optimizer) {
             { observer.started(optimizer) } -> std::same_as<void>;
@@ -75,6 +87,17 @@ namespace trading {
             { observer.cooled(optimizer) } -> std::same_as<void>;
             { observer.finished(optimizer) } -> std::same_as<void>;
         };
+
+        // observer of parallel tempering, the chain events can be called from any thread
+        template<class Observer, class Optimizer>
+        concept ITemperingObserver = requires(Observer& observer, const Optimizer& optimizer, std::size_t chain) {
+            { observer.started(optimizer) } -> std::same_as<void>;
+            { observer.better_accepted(optimizer, chain) } -> std::same_as<void>;
+            { observer.worse_accepted(optimizer, chain) } -> std::same_as<void>;
+            { observer.exchanged(optimizer, chain) } -> std::same_as<void>;
+            { observer.iteration_passed(optimizer) } -> std::same_as<void>;
+            { observer.finished(optimizer) } -> std::same_as<void>;
+        };
     }
 
     namespace tabu_search {
@@ -125,6 +148,13 @@ namespace trading {
     concept ISearchSpace = std::invocable<ConcreteSearchSpace> &&
             std::same_as<cppcoro::generator<Config>, std::invoke_result_t<ConcreteSearchSpace>>;
 
+    // search space, that can be split into index ranges without generating it
+    template<class ConcreteSearchSpace, class Config>
+    concept IRandomAccessSearchSpace = requires(const ConcreteSearchSpace& search_space, std::size_t index) {
+        { search_space.size() } -> std::convertible_to<std::size_t>;
+        { search_space.at(index) } -> std::convertible_to<Config>;
+    };
+
     template<class ConcreteResult, class Type>
     concept IResult = requires(ConcreteResult& result, const Type& candidate) {
         { result.update(candidate) } -> std::same_as<void>;
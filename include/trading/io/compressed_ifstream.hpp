@@ -0,0 +1,201 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_IO_COMPRESSED_IFSTREAM_HPP
+#define BACKTESTING_IO_COMPRESSED_IFSTREAM_HPP
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <fstream>
+#include <istream>
+#include <streambuf>
+#include <exception>
+#include <stop_token>
+#include <filesystem>
+#include <condition_variable>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
+
+namespace trading::io {
+    enum class compression {
+        none,
+        gzip,
+        zstd,
+    };
+
+    // deduces the compression from the extension of the file
+    inline compression compression_of(const std::filesystem::path& path)
+    {
+        auto extension = path.extension();
+        if (extension==".gz") return compression::gzip;
+        if (extension==".zst") return compression::zstd;
+        return compression::none;
+    }
+
+    // Decompresses the file on a separate thread into a bounded queue of blocks, so the decompression
+    // overlaps with the parsing of the already decompressed blocks.
+    class decompressing_buffer : public std::streambuf {
+        using block_type = std::vector<char>;
+
+        std::size_t block_size_, block_count_;
+        std::deque<block_type> filled_, free_;
+        block_type curr_;
+        bool finished_{false};
+        std::exception_ptr error_;
+        std::mutex mutex_;
+        std::condition_variable_any changed_;
+        std::jthread decompressor_;
+
+        void decompress(std::stop_token stop, std::ifstream file, compression type)
+        {
+            try {
+                boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+                if (type==compression::gzip)
+                    in.push(boost::iostreams::gzip_decompressor{});
+                else if (type==compression::zstd)
+                    in.push(boost::iostreams::zstd_decompressor{});
+                in.push(file);
+
+                while (true) {
+                    block_type block;
+                    {
+                        std::unique_lock lock{mutex_};
+                        if (!changed_.wait(lock, stop, [&] { return !free_.empty(); })) return;
+                        block = std::move(free_.front());
+                        free_.pop_front();
+                    }
+
+                    block.resize(block_size_);
+                    std::size_t size{0};
+                    for (std::streamsize read; size<block_size_ &&
+                            (read = in.sgetn(block.data()+size, static_cast<std::streamsize>(block_size_-size)))>0;)
+                        size += read;
+                    block.resize(size);
+
+                    std::lock_guard lock{mutex_};
+                    if (size) filled_.emplace_back(std::move(block));
+                    if (size<block_size_) break;
+                    changed_.notify_all();
+                }
+            }
+            catch (...) {
+                std::lock_guard lock{mutex_};
+                error_ = std::current_exception();
+            }
+            std::lock_guard lock{mutex_};
+            finished_ = true;
+            changed_.notify_all();
+        }
+
+    protected:
+        int_type underflow() override
+        {
+            if (gptr()<egptr()) return traits_type::to_int_type(*gptr());
+
+            std::unique_lock lock{mutex_};
+            if (curr_.capacity()) {
+                free_.emplace_back(std::move(curr_));
+                curr_ = block_type{};
+                changed_.notify_all();
+            }
+            changed_.wait(lock, [&] { return !filled_.empty() || finished_; });
+
+            if (filled_.empty()) {
+                setg(nullptr, nullptr, nullptr);
+                if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+                return traits_type::eof();
+            }
+            curr_ = std::move(filled_.front());
+            filled_.pop_front();
+            setg(curr_.data(), curr_.data(), curr_.data()+curr_.size());
+            return traits_type::to_int_type(*gptr());
+        }
+
+    public:
+        explicit decompressing_buffer(std::size_t block_size = std::size_t{1} << 20, std::size_t block_count = 4)
+                :block_size_(block_size), block_count_(block_count) { }
+
+        decompressing_buffer(const decompressing_buffer&) = delete;
+        decompressing_buffer& operator=(const decompressing_buffer&) = delete;
+
+        // starts decompressing the file, returns false when it cannot be opened
+        bool open(const std::filesystem::path& path, compression type)
+        {
+            std::ifstream file{path, std::ios::binary};
+            if (!file.is_open()) return false;
+
+            for (std::size_t i{0}; i<block_count_; i++)
+                free_.emplace_back().reserve(block_size_);
+            decompressor_ = std::jthread{[this, type](std::stop_token stop, std::ifstream file) {
+                decompress(stop, std::move(file), type);
+            }, std::move(file)};
+            return true;
+        }
+
+        bool is_open() const
+        {
+            return decompressor_.joinable();
+        }
+
+        ~decompressing_buffer() override
+        {
+            if (decompressor_.joinable()) {
+                decompressor_.request_stop();
+                decompressor_.join();
+            }
+        }
+    };
+
+    // Input file stream, that decompresses gzip (.gz) and zstd (.zst) files on the fly, other files are read
+    // directly from the file buffer without the decompressing thread. Decompression errors are thrown
+    // from the reading functions.
+    class compressed_ifstream : public std::istream {
+        std::filebuf file_buffer_;
+        decompressing_buffer buffer_;
+
+    public:
+        compressed_ifstream()
+                :std::istream(&file_buffer_)
+        {
+            exceptions(std::ios::badbit);
+        }
+
+        explicit compressed_ifstream(const std::filesystem::path& path)
+                :compressed_ifstream()
+        {
+            open(path);
+        }
+
+        void open(const std::filesystem::path& path)
+        {
+            auto type = compression_of(path);
+            if (type==compression::none) {
+                if (!file_buffer_.open(path, std::ios::in | std::ios::binary))
+                    setstate(std::ios::failbit);
+                return;
+            }
+
+            rdbuf(&buffer_);
+            if (!buffer_.open(path, type))
+                setstate(std::ios::failbit);
+        }
+
+        bool is_open() const
+        {
+            return file_buffer_.is_open() || buffer_.is_open();
+        }
+
+        // whether the file is decompressed on the separate thread
+        bool decompressing() const
+        {
+            return buffer_.is_open();
+        }
+    };
+}
+
+#endif //BACKTESTING_IO_COMPRESSED_IFSTREAM_HPP
@@ -22,11 +22,12 @@
 #include <typeinfo>
 
 namespace trading::io::csv {
-    template<std::size_t n_cols>
-    class reader final : public base<n_cols, std::ifstream> {
+    // FileStream can be any input file stream with open and is_open, e.g. io::compressed_ifstream
+    template<std::size_t n_cols, class FileStream = std::ifstream>
+    class reader final : public base<n_cols, FileStream> {
         std::string line_;
         static_assert(n_cols>0);
-        using base_type = base<n_cols, std::ifstream>;
+        using base_type = base<n_cols, FileStream>;
 
         template<class Value>
         void read_value(std::stringstream& line, Value& val)
@@ -56,7 +57,7 @@ namespace trading::io::csv {
             if (!std::filesystem::exists(path))
                 throw std::invalid_argument("File does not exist");
 
-            this->file_ = typename base_type::file_stream_type{path.string()};
+            this->file_.open(path.string());
 
             if (!this->file_.is_open())
                 throw std::runtime_error("Cannot open "+path.string());
@@ -0,0 +1,141 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_IO_CSV_TICK_READER_HPP
+#define BACKTESTING_IO_CSV_TICK_READER_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <charconv>
+#include <stdexcept>
+#include <filesystem>
+#include <trading/types.hpp>
+#include <trading/tick_aggregator.hpp>
+#include <trading/candle_validator.hpp>
+
+namespace trading::io::csv {
+    // Reads trades (timestamp, price, quantity) in large blocks and parses them without copying lines,
+    // so the aggregation keeps up with the disk. The timestamps are converted to seconds.
+    class tick_reader {
+        std::ifstream file_;
+        char delim_;
+        std::int64_t units_per_second_;
+        std::vector<char> buffer_;
+        std::size_t begin_{0}, end_{0};     // unparsed part of the buffer
+        bool skip_header_;
+
+        static std::int64_t validate_units_per_second(std::int64_t units_per_second)
+        {
+            if (units_per_second<=0)
+                throw std::invalid_argument("Units per second have to be greater than 0");
+            return units_per_second;
+        }
+
+        static std::size_t validate_block_size(std::size_t block_size)
+        {
+            if (!block_size)
+                throw std::invalid_argument("Block size has to be greater than 0");
+            return block_size;
+        }
+
+        template<class Value>
+        const char* parse(const char* first, const char* last, Value& value) const
+        {
+            auto [ptr, ec] = std::from_chars(first, last, value);
+            if (ec!=std::errc{})
+                throw std::runtime_error("Unable to parse value from: "+std::string{first, last});
+            return ptr;
+        }
+
+        const char* skip_delim(const char* first, const char* last) const
+        {
+            if (first==last || *first!=delim_)
+                throw std::runtime_error("Missing delimiter in: "+std::string{first, last});
+            return first+1;
+        }
+
+        void parse_line(const char* first, const char* last, tick_columns& ticks) const
+        {
+            if (first!=last && *(last-1)=='\r') last--;
+            if (first==last) return;
+
+            std::int64_t time;
+            price_t price;
+            amount_t quantity;
+            first = skip_delim(parse(first, last, time), last);
+            first = skip_delim(parse(first, last, price), last);
+            parse(first, last, quantity);
+            ticks.emplace_back(static_cast<std::time_t>(time/units_per_second_), price, quantity);
+        }
+
+        // moves the unparsed rest to the front and reads the next block after it
+        bool fill()
+        {
+            std::memmove(buffer_.data(), buffer_.data()+begin_, end_-begin_);
+            end_ -= begin_;
+            begin_ = 0;
+            if (end_==buffer_.size()) buffer_.resize(2*buffer_.size());
+
+            file_.read(buffer_.data()+end_, static_cast<std::streamsize>(buffer_.size()-end_));
+            end_ += file_.gcount();
+            return file_.gcount()>0;
+        }
+
+    public:
+        explicit tick_reader(const std::filesystem::path& path, char delim = ',', bool skip_header = false,
+                std::int64_t units_per_second = 1, std::size_t block_size = std::size_t{1} << 20)
+                :delim_(delim), units_per_second_(validate_units_per_second(units_per_second)),
+                 buffer_(validate_block_size(block_size)), skip_header_(skip_header)
+        {
+            if (!std::filesystem::exists(path))
+                throw std::invalid_argument("File does not exist");
+
+            file_ = std::ifstream{path, std::ios::binary};
+            if (!file_.is_open())
+                throw std::runtime_error("Cannot open "+path.string());
+        }
+
+        // replaces the ticks with the next block of trades, returns false when there are no more
+        bool read(tick_columns& ticks)
+        {
+            ticks.clear();
+            while (!ticks.size()) {
+                bool read = fill();
+                if (!read && begin_==end_) return false;
+
+                const char* data = buffer_.data();
+                while (begin_<end_) {
+                    auto newline = static_cast<const char*>(std::memchr(data+begin_, '\n', end_-begin_));
+
+                    // the last line may miss the new line
+                    if (!newline && read) break;
+                    std::size_t line_end = newline ? newline-data : end_;
+
+                    if (skip_header_)
+                        skip_header_ = false;
+                    else
+                        parse_line(data+begin_, data+line_end, ticks);
+                    begin_ = newline ? line_end+1 : end_;
+                }
+                if (!read) break;
+            }
+            return ticks.size();
+        }
+    };
+
+    // aggregates the trades of the file into candles of the period
+    inline candle_columns aggregate_ticks(tick_reader& reader, tick_aggregator& aggregator)
+    {
+        candle_columns candles;
+        tick_columns ticks;
+        while (reader.read(ticks))
+            aggregator(ticks, candles);
+        aggregator.finish(candles);
+        return candles;
+    }
+}
+
+#endif //BACKTESTING_IO_CSV_TICK_READER_HPP
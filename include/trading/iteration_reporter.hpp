@@ -0,0 +1,59 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_ITERATION_REPORTER_HPP
+#define BACKTESTING_ITERATION_REPORTER_HPP
+
+#include <cstddef>
+
+namespace trading {
+    // Observer of any optimizer, that calls the report of the derived class after each iteration.
+    template<class Derived>
+    class iteration_reporter {
+        template<class Optimizer>
+        void notify(const Optimizer& optimizer)
+        {
+            static_cast<Derived&>(*this).report(optimizer);
+        }
+
+    public:
+        template<class Optimizer>
+        void started(const Optimizer&) { }
+
+        template<class Optimizer, class... Chain>
+        void better_accepted(const Optimizer&, Chain...) { }
+
+        template<class Optimizer, class... Chain>
+        void worse_accepted(const Optimizer&, Chain...) { }
+
+        template<class Optimizer>
+        void exchanged(const Optimizer&, std::size_t) { }
+
+        template<class Optimizer>
+        void cooled(const Optimizer& optimizer)
+        {
+            notify(optimizer);
+        }
+
+        template<class Optimizer, class... Fitness>
+        void population_updated(const Optimizer& optimizer, Fitness...)
+        {
+            notify(optimizer);
+        }
+
+        template<class Optimizer>
+        void iteration_passed(const Optimizer& optimizer)
+        {
+            notify(optimizer);
+        }
+
+        template<class Optimizer>
+        void finished(const Optimizer& optimizer)
+        {
+            notify(optimizer);
+        }
+    };
+}
+
+#endif //BACKTESTING_ITERATION_REPORTER_HPP
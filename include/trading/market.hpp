@@ -81,7 +81,7 @@ namespace trading {
             return active_position_.has_value();
         }
 
-        position active_position()
+        position active_position() const
         {
             assert(active_position_);
             return *active_position_;
@@ -46,6 +46,12 @@ namespace trading {
             return cum_sizes_[curr_idx++]*rest;
         }
 
+        // fractions of the remaining amount spent by each order
+        const std::array<double, n_sizes>& cumulative_sizes() const
+        {
+            return cum_sizes_;
+        }
+
         explicit order_sizer(const std::array<fraction_t, n_sizes>& fracs)
                 :cum_sizes_(compute_cumulative_sizes(validate_sizes(fracs))) { }
 
@@ -0,0 +1,352 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_PAPER_FEED_HPP
+#define BACKTESTING_PAPER_FEED_HPP
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <optional>
+#include <stdexcept>
+#include <filesystem>
+#include <stop_token>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/socket.h>
+#include <trading/types.hpp>
+#include <trading/candle.hpp>
+#include <trading/candle_validator.hpp>
+#include <trading/io/parser.hpp>
+
+namespace trading::paper {
+    // binary layout of a candle in files and sockets
+    struct candle_record {
+        std::int64_t opened;
+        price_t open, high, low, close;
+    };
+    static_assert(sizeof(candle_record)==24);
+
+    inline candle_record to_record(const candle& candle)
+    {
+        return {candle.opened(), candle.open(), candle.high(), candle.low(), candle.close()};
+    }
+
+    inline candle from_record(const candle_record& record)
+    {
+        return candle{record.opened, record.open, record.high, record.low, record.close};
+    }
+
+    inline const std::filesystem::path& validate_path(const std::filesystem::path& path)
+    {
+        if (!std::filesystem::exists(path))
+            throw std::invalid_argument("File does not exist");
+        return path;
+    }
+
+    // Feeds below are polled, next returns nothing when no complete candle is available yet.
+
+    // replays candles from memory
+    class memory_feed {
+        std::vector<candle> candles_;
+        std::size_t next_{0};
+
+    public:
+        explicit memory_feed(std::vector<candle> candles)
+                :candles_(std::move(candles)) { }
+
+        std::optional<candle> next()
+        {
+            if (next_==candles_.size()) return std::nullopt;
+            return candles_[next_++];
+        }
+
+        bool exhausted() const
+        {
+            return next_==candles_.size();
+        }
+    };
+
+    // tails a growing csv file of opened, open, high, low and close columns
+    class csv_feed {
+        std::ifstream file_;
+        char delim_;
+        bool skip_header_;
+
+        static std::ifstream open(const std::filesystem::path& path)
+        {
+            std::ifstream file{validate_path(path)};
+            if (!file.is_open())
+                throw std::runtime_error("Cannot open "+path.string());
+            return file;
+        }
+
+        candle parse(const std::string& line) const
+        {
+            std::stringstream ss{line};
+            std::array<std::string, 5> values;
+            for (auto& value: values)
+                if (!std::getline(ss, value, delim_))
+                    throw std::runtime_error("Incomplete candle: "+line);
+
+            return candle{io::parser::parse<long>(values[0]), io::parser::parse<price_t>(values[1]),
+                          io::parser::parse<price_t>(values[2]), io::parser::parse<price_t>(values[3]),
+                          io::parser::parse<price_t>(values[4])};
+        }
+
+    public:
+        explicit csv_feed(const std::filesystem::path& path, char delim = ',', bool skip_header = false)
+                :file_(open(path)), delim_(delim), skip_header_(skip_header) { }
+
+        std::optional<candle> next()
+        {
+            std::string line;
+            while (true) {
+                file_.clear();
+                auto begin = file_.tellg();
+
+                // the line is not complete until its end of line is written
+                if (!std::getline(file_, line) || file_.eof()) {
+                    file_.clear();
+                    file_.seekg(begin);
+                    return std::nullopt;
+                }
+                if (!line.empty() && line.back()=='\r') line.pop_back();
+                if (skip_header_) {
+                    skip_header_ = false;
+                    continue;
+                }
+                if (!line.empty()) return parse(line);
+            }
+        }
+
+        bool exhausted() const
+        {
+            return false;
+        }
+    };
+
+    // tails a growing file of candle records
+    class binary_feed {
+        std::ifstream file_;
+
+    public:
+        explicit binary_feed(const std::filesystem::path& path)
+                :file_(validate_path(path), std::ios::binary)
+        {
+            if (!file_.is_open())
+                throw std::runtime_error("Cannot open "+path.string());
+        }
+
+        std::optional<candle> next()
+        {
+            file_.clear();
+            auto begin = file_.tellg();
+            candle_record record;
+
+            if (!file_.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+                file_.clear();
+                file_.seekg(begin);
+                return std::nullopt;
+            }
+            return from_record(record);
+        }
+
+        bool exhausted() const
+        {
+            return false;
+        }
+    };
+
+    // Listens on a Unix domain socket and receives candle records from a single connected producer.
+    // It is exhausted, when the producer disconnects.
+    class socket_feed {
+        int listener_{-1}, conn_{-1};
+        std::filesystem::path path_;
+        std::array<char, sizeof(candle_record)> buffer_{};
+        std::size_t filled_{0};
+        bool closed_{false};
+
+        static void set_non_blocking(int fd)
+        {
+            if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK)<0)
+                throw std::runtime_error(std::string{"Cannot set non-blocking socket: "}+std::strerror(errno));
+        }
+
+    public:
+        explicit socket_feed(const std::filesystem::path& path)
+                :path_(path)
+        {
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            if (path.string().size()>=sizeof(addr.sun_path))
+                throw std::invalid_argument("Socket path is too long");
+            std::strcpy(addr.sun_path, path.c_str());
+
+            listener_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (listener_<0)
+                throw std::runtime_error(std::string{"Cannot create socket: "}+std::strerror(errno));
+
+            ::unlink(path.c_str());
+            if (::bind(listener_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr))<0 || ::listen(listener_, 1)<0) {
+                ::close(listener_);
+                throw std::runtime_error(std::string{"Cannot listen on "}+path.string()+": "+std::strerror(errno));
+            }
+            set_non_blocking(listener_);
+        }
+
+        socket_feed(const socket_feed&) = delete;
+        socket_feed& operator=(const socket_feed&) = delete;
+
+        ~socket_feed()
+        {
+            if (conn_>=0) ::close(conn_);
+            ::close(listener_);
+            ::unlink(path_.c_str());
+        }
+
+        std::optional<candle> next()
+        {
+            if (closed_) return std::nullopt;
+            if (conn_<0) {
+                conn_ = ::accept(listener_, nullptr, nullptr);
+                if (conn_<0) return std::nullopt;
+                set_non_blocking(conn_);
+            }
+
+            while (filled_<buffer_.size()) {
+                auto received = ::recv(conn_, buffer_.data()+filled_, buffer_.size()-filled_, 0);
+                if (received>0) {
+                    filled_ += received;
+                }
+                else {
+                    closed_ = !received || (errno!=EAGAIN && errno!=EWOULDBLOCK);
+                    return std::nullopt;
+                }
+            }
+
+            filled_ = 0;
+            candle_record record;
+            std::memcpy(&record, buffer_.data(), sizeof(record));
+            return from_record(record);
+        }
+
+        bool exhausted() const
+        {
+            return closed_;
+        }
+    };
+
+    // Writers of the feeds, used to replay recorded candles into a feed.
+
+    class csv_feed_writer {
+        std::ofstream file_;
+        char delim_;
+
+    public:
+        explicit csv_feed_writer(const std::filesystem::path& path, char delim = ',')
+                :file_(path, std::ios::app), delim_(delim)
+        {
+            if (!file_.is_open())
+                throw std::runtime_error("Cannot open "+path.string());
+        }
+
+        void operator()(const candle& candle)
+        {
+            file_ << candle.opened() << delim_ << candle.open() << delim_ << candle.high() << delim_
+                  << candle.low() << delim_ << candle.close() << '\n' << std::flush;
+        }
+    };
+
+    class binary_feed_writer {
+        std::ofstream file_;
+
+    public:
+        explicit binary_feed_writer(const std::filesystem::path& path)
+                :file_(path, std::ios::binary | std::ios::app)
+        {
+            if (!file_.is_open())
+                throw std::runtime_error("Cannot open "+path.string());
+        }
+
+        void operator()(const candle& candle)
+        {
+            auto record = to_record(candle);
+            file_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+            file_.flush();
+        }
+        // writes the candles at once
+        void operator()(const candle_columns& candles)
+        {
+            std::vector<candle_record> records(candles.size());
+            for (std::size_t i{0}; i<candles.size(); i++)
+                records[i] = {candles.opened[i], candles.open[i], candles.high[i], candles.low[i], candles.close[i]};
+            file_.write(reinterpret_cast<const char*>(records.data()),
+                    static_cast<std::streamsize>(records.size()*sizeof(candle_record)));
+            file_.flush();
+        }
+    };
+
+    class socket_feed_writer {
+        int socket_;
+
+    public:
+        explicit socket_feed_writer(const std::filesystem::path& path)
+        {
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            if (path.string().size()>=sizeof(addr.sun_path))
+                throw std::invalid_argument("Socket path is too long");
+            std::strcpy(addr.sun_path, path.c_str());
+
+            socket_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (socket_<0 || ::connect(socket_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr))<0) {
+                if (socket_>=0) ::close(socket_);
+                throw std::runtime_error(std::string{"Cannot connect to "}+path.string()+": "+std::strerror(errno));
+            }
+        }
+
+        socket_feed_writer(const socket_feed_writer&) = delete;
+        socket_feed_writer& operator=(const socket_feed_writer&) = delete;
+
+        ~socket_feed_writer()
+        {
+            ::close(socket_);
+        }
+
+        void operator()(const candle& candle)
+        {
+            auto record = to_record(candle);
+            const char* data = reinterpret_cast<const char*>(&record);
+            for (std::size_t sent{0}; sent<sizeof(record);) {
+                auto written = ::send(socket_, data+sent, sizeof(record)-sent, MSG_NOSIGNAL);
+                if (written<0)
+                    throw std::runtime_error(std::string{"Cannot send candle: "}+std::strerror(errno));
+                sent += written;
+            }
+        }
+    };
+
+    // writes the recorded candles into a feed, one per interval
+    template<class Writer>
+    void replay(const std::vector<candle>& candles, Writer& writer, std::chrono::microseconds interval,
+            std::stop_token stop = {})
+    {
+        for (const auto& candle: candles) {
+            if (stop.stop_requested()) break;
+            writer(candle);
+            std::this_thread::sleep_for(interval);
+        }
+    }
+}
+
+#endif //BACKTESTING_PAPER_FEED_HPP
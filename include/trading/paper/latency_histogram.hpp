@@ -0,0 +1,93 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_PAPER_LATENCY_HISTOGRAM_HPP
+#define BACKTESTING_PAPER_LATENCY_HISTOGRAM_HPP
+
+#include <bit>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+
+namespace trading::paper {
+    // Histogram of latencies in nanoseconds with log-linear buckets, 32 per power of two,
+    // so the percentiles are accurate to about 3 % with constant memory and recording time.
+    class latency_histogram {
+        static constexpr std::size_t sub_bits{5}, sub_count{1<<sub_bits};
+        static constexpr std::size_t linear_count{2*sub_count};
+        static constexpr std::size_t bucket_count{linear_count+(64-sub_bits-1)*sub_count};
+
+        std::array<std::uint64_t, bucket_count> counts_{};
+        std::uint64_t count_{0}, max_{0}, min_{UINT64_MAX};
+
+        static std::size_t index(std::uint64_t value)
+        {
+            if (value<linear_count) return value;
+            std::size_t shift = std::bit_width(value)-1-sub_bits;
+            return linear_count+(shift-1)*sub_count+((value >> shift)-sub_count);
+        }
+
+        // the highest value of the bucket
+        static std::uint64_t highest(std::size_t idx)
+        {
+            if (idx<linear_count) return idx;
+            std::size_t shift = (idx-linear_count)/sub_count+1;
+            std::uint64_t top = (idx-linear_count)%sub_count+sub_count;
+            return ((top+1) << shift)-1;
+        }
+
+    public:
+        void record(std::chrono::nanoseconds latency)
+        {
+            auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+            counts_[index(value)]++;
+            count_++;
+            max_ = std::max(max_, value);
+            min_ = std::min(min_, value);
+        }
+
+        // the latency, that the fraction of the records does not exceed
+        std::chrono::nanoseconds percentile(double fraction) const
+        {
+            if (fraction<0.0 || fraction>1.0)
+                throw std::invalid_argument("Fraction has to be in interval [0, 1]");
+            if (!count_) return std::chrono::nanoseconds{0};
+
+            auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(fraction*count_+0.5));
+            std::uint64_t seen{0};
+            for (std::size_t i{0}; i<bucket_count; i++)
+                if ((seen += counts_[i])>=rank)
+                    return std::chrono::nanoseconds{std::clamp(highest(i), min_, max_)};
+            return max();
+        }
+
+        std::chrono::nanoseconds max() const
+        {
+            return std::chrono::nanoseconds{max_};
+        }
+
+        std::chrono::nanoseconds min() const
+        {
+            return std::chrono::nanoseconds{count_ ? min_ : 0};
+        }
+
+        std::uint64_t count() const
+        {
+            return count_;
+        }
+
+        void merge(const latency_histogram& other)
+        {
+            for (std::size_t i{0}; i<bucket_count; i++)
+                counts_[i] += other.counts_[i];
+            count_ += other.count_;
+            max_ = std::max(max_, other.max_);
+            min_ = std::min(min_, other.min_);
+        }
+    };
+}
+
+#endif //BACKTESTING_PAPER_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,111 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_PAPER_LOG_SINK_HPP
+#define BACKTESTING_PAPER_LOG_SINK_HPP
+
+#include <bit>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <vector>
+#include <ostream>
+#include <stdexcept>
+
+namespace trading::paper {
+    // Writes records to the stream on a background thread. Pushing never blocks nor allocates,
+    // the records are dropped and counted when the queue is full. Single producer only.
+    template<class Record>
+    class log_sink {
+        std::vector<Record> ring_;
+        std::size_t mask_;
+        alignas(64) std::atomic<std::size_t> head_{0};  // next to be written by the consumer
+        alignas(64) std::atomic<std::size_t> tail_{0};  // next to be pushed by the producer
+        std::atomic<std::size_t> dropped_count_{0}, written_count_{0};
+        std::ostream& out_;
+        std::chrono::microseconds poll_interval_;
+        std::jthread writer_;
+
+        static std::size_t validate_capacity(std::size_t capacity)
+        {
+            if (!std::has_single_bit(capacity))
+                throw std::invalid_argument("Capacity has to be a power of two");
+            return capacity;
+        }
+
+        void drain()
+        {
+            std::size_t head = head_.load(std::memory_order_relaxed);
+            std::size_t tail = tail_.load(std::memory_order_acquire);
+            for (; head!=tail; head++)
+                out_ << ring_[head & mask_] << '\n';
+            if (written_count_.exchange(head)!=head) out_.flush();
+            head_.store(head, std::memory_order_release);
+        }
+
+        // the wait is interrupted by the stop request
+        void write(std::stop_token stop)
+        {
+            std::mutex mutex;
+            std::condition_variable_any stopped;
+            std::unique_lock lock{mutex};
+
+            while (!stop.stop_requested()) {
+                drain();
+                stopped.wait_for(lock, stop, poll_interval_, [] { return false; });
+            }
+            drain();
+        }
+
+    public:
+        explicit log_sink(std::ostream& out, std::size_t capacity = 1<<16,
+                std::chrono::microseconds poll_interval = std::chrono::milliseconds{1})
+                :ring_(validate_capacity(capacity)), mask_(capacity-1), out_(out), poll_interval_(poll_interval),
+                 writer_([this](std::stop_token stop) { write(stop); }) { }
+
+        log_sink(const log_sink&) = delete;
+        log_sink& operator=(const log_sink&) = delete;
+
+        // returns false when the record is dropped
+        bool push(const Record& record)
+        {
+            std::size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail-head_.load(std::memory_order_acquire)>mask_) {
+                dropped_count_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            ring_[tail & mask_] = record;
+            tail_.store(tail+1, std::memory_order_release);
+            return true;
+        }
+
+        // stops the writer after writing the pushed records
+        void close()
+        {
+            if (writer_.joinable()) {
+                writer_.request_stop();
+                writer_.join();
+            }
+        }
+
+        ~log_sink()
+        {
+            close();
+        }
+
+        std::size_t dropped_count() const
+        {
+            return dropped_count_.load(std::memory_order_relaxed);
+        }
+
+        std::size_t written_count() const
+        {
+            return written_count_.load(std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif //BACKTESTING_PAPER_LOG_SINK_HPP
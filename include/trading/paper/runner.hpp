@@ -0,0 +1,108 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_PAPER_RUNNER_HPP
+#define BACKTESTING_PAPER_RUNNER_HPP
+
+#include <chrono>
+#include <thread>
+#include <ostream>
+#include <stop_token>
+#include <trading/types.hpp>
+#include <trading/action.hpp>
+#include <trading/candle.hpp>
+#include <trading/interface.hpp>
+#include <trading/data_point.hpp>
+#include <trading/time_resampler.hpp>
+#include <trading/paper/log_sink.hpp>
+#include <trading/paper/latency_histogram.hpp>
+
+namespace trading::paper {
+    struct decision_record {
+        std::time_t time;
+        action done;
+        price_t price;
+        amount_t equity;
+        std::chrono::nanoseconds latency;
+
+        friend std::ostream& operator<<(std::ostream& os, const decision_record& record)
+        {
+            return os << record.time << ',' << (record.done==action::opened ? "open" : "close all") << ','
+                      << record.price << ',' << record.equity << ',' << record.latency.count();
+        }
+    };
+
+    // Trades on paper as the candles arrive, deciding the same as the trader driven by the simulator
+    // with the same resampler. Decisions are written through the sink and the latency of each candle,
+    // from its arrival to the decision, is recorded.
+    template<class Trader, IAverager Averager = candle::ohlc4>
+    class runner {
+        using clock = std::chrono::steady_clock;
+
+        Trader trader_;
+        live_resampler resampler_;
+        log_sink<decision_record>& sink_;
+        amount_t min_equity_;
+        Averager averager_;
+        latency_histogram histogram_;
+        bool stopped_{false};
+
+    public:
+        runner(const Trader& trader, const time_resampler& resampler, log_sink<decision_record>& sink,
+                amount_t min_equity, Averager averager = Averager{})
+                :trader_(trader), resampler_(resampler), sink_(sink), min_equity_(min_equity), averager_(averager) { }
+
+        // Processes a new candle, the candles have to arrive in chronological order.
+        // Returns the decision, no decision is made once the equity falls to the minimum.
+        action operator()(const candle& curr)
+        {
+            auto began = clock::now();
+            action done{action::none};
+            price_point point{curr.opened(), curr.close()};
+
+            if (auto closed = resampler_.add(curr)) trader_.update_indicators(averager_(*closed));
+            if (!stopped_ && !(stopped_ = !(trader_.equity(point.data)>min_equity_)))
+                done = trader_(point);
+            if (auto closed = resampler_.complete(curr)) trader_.update_indicators(averager_(*closed));
+
+            auto latency = clock::now()-began;
+            histogram_.record(latency);
+            if (done!=action::none)
+                sink_.push(decision_record{point.time, done, point.data, trader_.equity(point.data), latency});
+            return done;
+        }
+
+        // polls the feed until it is exhausted, the stop is requested or the trader stops
+        template<class Feed>
+        void run(Feed& feed, std::stop_token stop,
+                std::chrono::microseconds poll_interval = std::chrono::microseconds{100})
+        {
+            while (!stop.stop_requested() && !stopped_) {
+                if (auto curr = feed.next())
+                    (*this)(*curr);
+                else if (feed.exhausted())
+                    break;
+                else
+                    std::this_thread::sleep_for(poll_interval);
+            }
+        }
+
+        const latency_histogram& histogram() const
+        {
+            return histogram_;
+        }
+
+        const Trader& trader() const
+        {
+            return trader_;
+        }
+
+        bool stopped() const
+        {
+            return stopped_;
+        }
+    };
+}
+
+#endif //BACKTESTING_PAPER_RUNNER_HPP
@@ -0,0 +1,191 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_PHASE_SIMULATOR_HPP
+#define BACKTESTING_PHASE_SIMULATOR_HPP
+
+#include <vector>
+#include <cassert>
+#include <stdexcept>
+#include <trading/types.hpp>
+#include <trading/action.hpp>
+#include <trading/candle.hpp>
+#include <trading/data_point.hpp>
+#include <trading/interface.hpp>
+#include <trading/time_resampler.hpp>
+
+namespace trading {
+    // Simulates one trader per resampling phase (offset) over the prices shared by all phases.
+    // When compacted, each phase steps from run to run of equal prices instead of visiting every tick.
+    class phase_simulator {
+        std::vector<price_point> prices_;
+        std::vector<std::time_t> offsets_;
+        std::vector<std::vector<price_t>> indic_prices_;
+        std::vector<std::vector<index_t>> indic_ends_;
+        std::vector<std::vector<index_t>> run_ends_;
+        std::time_t period_;
+        amount_t min_equity_;
+
+        static std::vector<std::time_t> validate_offsets(std::vector<std::time_t>&& offsets)
+        {
+            if (offsets.empty())
+                throw std::invalid_argument("At least one phase offset has to be provided");
+            return offsets;
+        }
+
+    public:
+        phase_simulator(const std::vector<candle>& candles, std::time_t period, std::time_t candle_period,
+                std::vector<std::time_t> offsets, IAverager auto&& averager, amount_t min_equity)
+                :offsets_(validate_offsets(std::move(offsets))), period_(period), min_equity_(min_equity)
+        {
+            assert(candles.size());
+            prices_.reserve(candles.size());
+            for (const auto& candle: candles)
+                prices_.emplace_back(price_point{candle.opened(), candle.close()});
+
+            indic_prices_.resize(offsets_.size());
+            indic_ends_.resize(offsets_.size());
+            run_ends_.resize(offsets_.size());
+
+            for (std::size_t p{0}; p<offsets_.size(); p++) {
+                auto resampled = time_resampler{period, candle_period, offsets_[p]}(candles);
+                indic_prices_[p].reserve(resampled.size());
+                indic_ends_[p].reserve(resampled.size());
+
+                for (const auto& bucket: resampled) {
+                    indic_prices_[p].emplace_back(averager(bucket.value));
+                    indic_ends_[p].emplace_back(bucket.last);
+                }
+            }
+        }
+
+        // every offset within the period, one candle apart
+        static std::vector<std::time_t> all_offsets(std::time_t period, std::time_t candle_period)
+        {
+            std::vector<std::time_t> offsets;
+            offsets.reserve(period/candle_period);
+            for (std::time_t offset{0}; offset<period; offset += candle_period)
+                offsets.emplace_back(offset);
+            return offsets;
+        }
+
+        // Collapses runs of equal prices per phase, that are not split by an indicator update of the phase.
+        // A phase then skips the rest of a run once a tick makes no decision, as in the simulator.
+        void compact()
+        {
+            if (compacted()) return;
+            for (std::size_t p{0}; p<offsets_.size(); p++) {
+                const auto& indic_ends = indic_ends_[p];
+                for (index_t i{1}, indic_idx{0}; i<=prices_.size(); i++) {
+                    while (indic_idx<indic_ends.size() && indic_ends[indic_idx]<i-1) indic_idx++;
+                    bool updated = indic_idx<indic_ends.size() && indic_ends[indic_idx]==i-1;
+                    if (i==prices_.size() || updated || prices_[i].data!=prices_[i-1].data)
+                        run_ends_[p].emplace_back(i);
+                }
+            }
+        }
+
+        bool compacted() const
+        {
+            return !run_ends_.front().empty();
+        }
+
+        // average number of ticks per run over all phases
+        double compression_ratio() const
+        {
+            if (!compacted()) return 1.0;
+            std::size_t run_count{0};
+            for (const auto& ends: run_ends_)
+                run_count += ends.size();
+            return static_cast<double>(prices_.size()*offsets_.size())/static_cast<double>(run_count);
+        }
+
+        // traders and observers are indexed by phase, each phase walks its own runs of the shared prices
+        template<class Trader, class Observer>
+        void operator()(std::vector<Trader>& traders, std::vector<Observer>& observers) const
+        {
+            assert(traders.size()==offsets_.size() && observers.size()==offsets_.size());
+            for (std::size_t p{0}; p<offsets_.size(); p++)
+                simulate(p, traders[p], observers[p]);
+        }
+
+        // the ticks of a run after one without a decision are not visited,
+        // only the last tick of a run can update the indicators
+        template<class Trader, class Observer>
+        void simulate(std::size_t phase, Trader& trader, Observer& observer) const
+        {
+            const auto& indic_prices = indic_prices_[phase];
+            const auto& indic_ends = indic_ends_[phase];
+            const auto& run_ends = run_ends_[phase];
+            const bool compact = compacted();
+            std::size_t indic_idx{0}, run_idx{0};
+            observer.started(trader, prices_.front());
+
+            for (index_t i{0}, next; i<prices_.size(); i = next) {
+                if (trader.equity(prices_[i].data)<=min_equity_) break;
+
+                action done = trader(prices_[i]);
+                observer.decided(trader, done, prices_[i]);
+
+                if (trader.position_active())
+                    observer.position_active(trader, prices_[i]);
+
+                next = i+1;
+                if (compact) {
+                    while (run_ends[run_idx]<=i) run_idx++;
+                    if (done==action::none) next = run_ends[run_idx];
+                }
+
+                if (indic_idx<indic_ends.size() && indic_ends[indic_idx]==next-1)
+                    if (trader.update_indicators(indic_prices[indic_idx++]))
+                        observer.indicators_updated(trader, prices_[next-1]);
+                assert(indic_idx==indic_ends.size() || indic_ends[indic_idx]>=next);
+            }
+            observer.finished(trader, prices_.back());
+        }
+
+        const std::vector<price_point>& prices() const
+        {
+            return prices_;
+        }
+
+        const std::vector<std::time_t>& offsets() const
+        {
+            return offsets_;
+        }
+
+        std::size_t phase_count() const
+        {
+            return offsets_.size();
+        }
+
+        const std::vector<price_t>& indicator_prices(std::size_t phase) const
+        {
+            return indic_prices_[phase];
+        }
+
+        const std::vector<index_t>& indicator_ends(std::size_t phase) const
+        {
+            return indic_ends_[phase];
+        }
+
+        // indices of prices after the end of each run of the phase, empty when not compacted
+        const std::vector<index_t>& run_ends(std::size_t phase) const
+        {
+            return run_ends_[phase];
+        }
+
+        std::time_t period() const
+        {
+            return period_;
+        }
+
+        amount_t minimum_equity() const
+        {
+            return min_equity_;
+        }
+    };
+}
+
+#endif //BACKTESTING_PHASE_SIMULATOR_HPP
@@ -0,0 +1,138 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_RANDOM_ENGINE_HPP
+#define BACKTESTING_RANDOM_ENGINE_HPP
+
+#include <array>
+#include <limits>
+#include <random>
+#include <cstdint>
+#include <cstddef>
+
+namespace trading::random {
+    // Counter based Philox4x32-10 engine. The numbers are the blocks of a counter encrypted by the seed,
+    // so the engine keeps only the seed, the counter and the current block instead of a state table.
+    // The upper half of the counter is the stream, the independent streams of the components, chains
+    // or threads are split from the same seed without any draws, so a run is repeated with its seed.
+    class philox_engine {
+    public:
+        using result_type = std::uint32_t;
+        using block_type = std::array<std::uint32_t, 4>;
+        using key_type = std::array<std::uint32_t, 2>;
+
+    private:
+        static constexpr std::uint32_t multiplier0{0xD2511F53}, multiplier1{0xCD9E8D57};
+        static constexpr std::uint32_t weyl0{0x9E3779B9}, weyl1{0xBB67AE85};
+        static constexpr std::size_t round_count{10};
+        static constexpr std::uint64_t weyl{0x9E3779B97F4A7C15};
+
+        std::uint64_t seed_, stream_, position_{0};
+        block_type block_{};
+        std::size_t index_{block_.size()};
+
+        // finalizer of splitmix64
+        static constexpr std::uint64_t mix(std::uint64_t x)
+        {
+            x = (x^(x >> 30))*0xBF58476D1CE4E5B9;
+            x = (x^(x >> 27))*0x94D049BB133111EB;
+            return x^(x >> 31);
+        }
+
+        void generate()
+        {
+            block_ = block({static_cast<std::uint32_t>(position_), static_cast<std::uint32_t>(position_ >> 32),
+                            static_cast<std::uint32_t>(stream_), static_cast<std::uint32_t>(stream_ >> 32)},
+                    {static_cast<std::uint32_t>(seed_), static_cast<std::uint32_t>(seed_ >> 32)});
+            position_++;
+            index_ = 0;
+        }
+
+    public:
+        explicit philox_engine(std::uint64_t seed, std::uint64_t stream = 0)
+                :seed_(seed), stream_(stream) { }
+
+        static constexpr result_type min()
+        {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        // encrypts the counter by the key
+        static constexpr block_type block(block_type counter, key_type key)
+        {
+            for (std::size_t r{0}; r<round_count; r++) {
+                std::uint64_t product0 = std::uint64_t{multiplier0}*counter[0];
+                std::uint64_t product1 = std::uint64_t{multiplier1}*counter[2];
+                counter = {static_cast<std::uint32_t>(product1 >> 32)^counter[1]^key[0],
+                           static_cast<std::uint32_t>(product1),
+                           static_cast<std::uint32_t>(product0 >> 32)^counter[3]^key[1],
+                           static_cast<std::uint32_t>(product0)};
+                key[0] += weyl0;
+                key[1] += weyl1;
+            }
+            return counter;
+        }
+
+        result_type operator()()
+        {
+            if (index_==block_.size()) generate();
+            return block_[index_++];
+        }
+
+        void discard(unsigned long long count)
+        {
+            std::size_t left = block_.size()-index_;
+            if (count<=left) {
+                index_ += count;
+                return;
+            }
+            count -= left;
+            position_ += count/block_.size();
+            index_ = block_.size();
+            if (count%block_.size()) {
+                generate();
+                index_ = count%block_.size();
+            }
+        }
+
+        // independent engine of the same seed, the same id gives the same engine
+        philox_engine split(std::uint64_t id) const
+        {
+            return philox_engine{seed_, mix(stream_+weyl*(id+1))};
+        }
+
+        std::uint64_t seed() const
+        {
+            return seed_;
+        }
+
+        std::uint64_t stream() const
+        {
+            return stream_;
+        }
+
+        bool operator==(const philox_engine&) const = default;
+    };
+
+    using engine = philox_engine;
+
+    // seed of a run, that does not have to be repeated
+    inline std::uint64_t device_seed()
+    {
+        std::random_device device;
+        return (std::uint64_t{device()} << 32)|device();
+    }
+
+    inline engine device_engine()
+    {
+        return engine{device_seed()};
+    }
+}
+
+#endif //BACKTESTING_RANDOM_ENGINE_HPP
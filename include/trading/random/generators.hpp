@@ -9,6 +9,7 @@
 #include <trading/types.hpp>
 #include <trading/generators.hpp>
 #include <trading/int_range.hpp>
+#include <trading/random/engine.hpp>
 #include <trading/bazooka/configuration.hpp>
 #include <trading/bazooka/indicator.hpp>
 #include <boost/assert.hpp>
@@ -18,7 +19,7 @@ namespace trading::random {
     template<std::size_t n_levels>
     class levels_generator : public trading::levels_generator<n_levels> {
         using base_type = trading::levels_generator<n_levels>;
-        std::mt19937 gen_;
+        random::engine gen_;
         std::vector<fraction_t> options_;
         std::array<std::size_t, n_levels> indices_;
         std::size_t change_count_;
@@ -34,8 +35,9 @@ namespace trading::random {
         using value_type = std::array<fraction_t, n_levels>;
 
         explicit levels_generator(size_t unique_count = n_levels,
-                fraction_t lower_bound = base_type::default_lower_bound, std::size_t change_count = 1)
-                :base_type(unique_count, lower_bound), gen_{std::random_device{}()}, change_count_{
+                fraction_t lower_bound = base_type::default_lower_bound, std::size_t change_count = 1,
+                random::engine gen = random::device_engine())
+                :base_type(unique_count, lower_bound), gen_{gen}, change_count_{
                 validate_change_count(change_count)}
         {
             options_.reserve(unique_count);
@@ -82,7 +84,7 @@ namespace trading::random {
 
     template<std::size_t n_sizes>
     class sizes_generator : public trading::sizes_generator<n_sizes> {
-        std::mt19937 gen_;
+        random::engine gen_;
         std::uniform_int_distribution<std::size_t> distrib_;
         std::array<std::size_t, n_sizes> indices_;
         std::size_t change_count_;
@@ -116,8 +118,8 @@ namespace trading::random {
         using base_type = trading::sizes_generator<n_sizes>;
 
         explicit sizes_generator(size_t unique_count = base_type::default_unique_count,
-                std::size_t change_n = min_change_count_)
-                :base_type(unique_count), gen_(std::random_device{}()),
+                std::size_t change_n = min_change_count_, random::engine gen = random::device_engine())
+                :base_type(unique_count), gen_(gen),
                  distrib_(1, this->max_num_), change_count_{validate_change_count(change_n)}
         {
             for (std::size_t i{0}; i<indices_.size(); i++)
@@ -156,12 +158,13 @@ namespace trading::random {
     template<class Type, template<class> class Distribution>
     class numeric_interval_generator {
     private:
-        std::mt19937 _gen;
+        random::engine _gen;
         Distribution<Type> _distrib;
 
     public:
-        explicit numeric_interval_generator(const Type& min, const Type& max)
-                :_gen{std::random_device{}()}, _distrib{min, max}
+        explicit numeric_interval_generator(const Type& min, const Type& max,
+                random::engine gen = random::device_engine())
+                :_gen{gen}, _distrib{min, max}
         {
             if (!(min<max)) throw std::invalid_argument("Maximum has to be greater than minimum");
         }
@@ -179,15 +182,16 @@ namespace trading::random {
     using int_interval_generator = numeric_interval_generator<Type, std::uniform_int_distribution>;
 
     class int_range_generator : public trading::int_range {
-        std::mt19937 gen_{std::random_device{}()};
+        random::engine gen_;
         std::uniform_int_distribution<int> distrib_;
         std::size_t change_span_;
 
     public:
         using value_type = int_range::value_type;
 
-        explicit int_range_generator(int from, int to, int step, std::size_t change_span = 1)
-                :trading::int_range(from, to, step), change_span_{change_span}
+        explicit int_range_generator(int from, int to, int step, std::size_t change_span = 1,
+                random::engine gen = random::device_engine())
+                :trading::int_range(from, to, step), gen_{gen}, change_span_{change_span}
         {
             auto max_span = n_vals_/2;
             if (!change_span_ || change_span>max_span)
@@ -231,13 +235,15 @@ namespace trading::random {
         random::sizes_generator<n_levels> rand_sizes_;
         random::levels_generator<n_levels> rand_levels_;
         random::int_range_generator rand_period_;
-        std::mt19937 gen_{std::random_device{}()};
+        random::engine gen_;
         std::uniform_int_distribution<std::size_t> coin_flip_{0, 1};
 
     public:
         explicit configuration_generator(const random::sizes_generator<n_levels>& rand_sizes,
-                random::levels_generator<n_levels> rand_levels, const random::int_range_generator& rand_period)
-                :rand_sizes_(rand_sizes), rand_levels_(std::move(rand_levels)), rand_period_(rand_period) { }
+                random::levels_generator<n_levels> rand_levels, const random::int_range_generator& rand_period,
+                random::engine gen = random::device_engine())
+                :rand_sizes_(rand_sizes), rand_levels_(std::move(rand_levels)), rand_period_(rand_period),
+                 gen_{gen} { }
 
         bazooka::configuration<n_levels> operator()()
         {
@@ -70,13 +70,14 @@ namespace trading {
             best_.reserve(best_count_+padding_);
         }
 
+        // bounded by the count rather than the capacity, which is not kept by copies
         void update(const Type& candidate)
         {
-            if (best_.size()<best_.capacity()-1) {
+            if (best_.size()<best_count_+padding_-1) {
                 best_.emplace_back(candidate);
                 std::push_heap(best_.begin(), best_.end(), this->comp_);
             }
-            else if (best_.size()==best_.capacity()-1) {
+            else if (best_.size()==best_count_+padding_-1) {
                 best_.emplace_back(candidate);
                 pop_heap(best_.begin(), best_.end(), this->comp_);
             }
@@ -88,7 +89,9 @@ namespace trading {
 
         std::vector<Type> get() const
         {
-            std::vector<Type> res{best_};
+            // once full, the last element is only a space for the next candidate
+            auto heap_end = best_.size()==best_count_+padding_ ? best_.end()-1 : best_.end();
+            std::vector<Type> res{best_.begin(), heap_end};
             std::sort_heap(res.begin(), res.end(), this->comp_);
             int n_remove{static_cast<int>(res.size()-best_count_)};
             if (n_remove>0) res.erase(res.end()-n_remove, res.end());
@@ -7,18 +7,29 @@
 
 #include <functional>
 #include <cmath>
+#include <random>
+#include <vector>
+#include <concepts>
+#include <type_traits>
+#include <algorithm>
 #include <trading/random/generators.hpp>
 #include <trading/interface.hpp>
 
 namespace trading::simulated_annealing {
+    // With speculation greater than one, the next candidates are drawn from the current state ahead and
+    // evaluated in parallel, the candidates after the first accepted one are discarded. The candidates are drawn
+    // from a copy of the neighbor, the neighbor itself is then advanced by the used draws only, so the chain
+    // is the same as without speculation. It requires a neighbor with value semantics.
     template<class State>
     class optimizer {
         double start_temp_, min_temp_, curr_temp_;
-        random::real_interval_generator<double> rand_prob_{0.0, 1.0};
-        std::size_t it_{0};
+        random::real_interval_generator<double> rand_prob_;
+        std::size_t it_{0}, speculation_;
         using state_t = State;
         using config_t = typename state_t::config_type;
         state_t curr_state_, best_state_;
+        std::vector<config_t> candidate_configs_;
+        std::vector<state_t> candidates_;
 
         static double validate_min_temp(const double min_temp)
         {
@@ -34,10 +45,79 @@ namespace trading::simulated_annealing {
             return start_temp;
         }
 
+        static std::size_t validate_speculation(std::size_t speculation)
+        {
+            if (!speculation)
+                throw std::invalid_argument("Speculation has to be greater than zero");
+            return speculation;
+        }
+
+        // returns true when the candidate is accepted
+        bool try_accept(const state_t& candidate, auto& result, auto&& constraints, auto&& appraise,
+                auto& ... observers)
+        {
+            if (result.compare(candidate, curr_state_)) {
+                curr_state_ = candidate;
+                (observers.better_accepted(*this), ...);
+
+                if (constraints(curr_state_))
+                    if (result.compare(curr_state_, best_state_)) {
+                        best_state_ = curr_state_;
+                        result.update(best_state_);
+                    }
+                return true;
+            }
+
+            double diff = appraise(curr_state_, candidate);
+            double threshold = std::exp(-diff/curr_temp_);
+            assert(threshold>=0.0 && threshold<=1.0);
+
+            if (rand_prob_()<threshold) {
+                curr_state_ = candidate;
+                (observers.worse_accepted(*this), ...);
+                return true;
+            }
+            return false;
+        }
+
+        template<class Neighbor>
+        static constexpr bool copyable = std::copy_constructible<std::remove_cvref_t<Neighbor>>;
+
+        void speculate(auto& result, auto&& constraints, auto&& objective, auto&& neighbor, auto&& appraise,
+                std::size_t n_tries, auto& ... observers)
+        {
+            if constexpr (copyable<decltype(neighbor)>) {
+                for (std::size_t e{0}; e<n_tries;) {
+                    std::size_t size = std::min(speculation_, n_tries-e);
+                    auto ahead = neighbor;
+                    candidate_configs_.resize(size);
+                    candidates_.resize(size);
+                    for (std::size_t i{0}; i<size; i++)
+                        candidate_configs_[i] = ahead(curr_state_.config);
+
+                    #pragma omp parallel for num_threads(size)
+                    for (std::size_t i = 0; i<size; i++)
+                        candidates_[i] = objective(candidate_configs_[i]);
+
+                    // draws used until the first accepted candidate
+                    auto origin = curr_state_.config;
+                    std::size_t used{0};
+                    while (used<size && !try_accept(candidates_[used], result, constraints, appraise, observers...))
+                        used++;
+                    used = std::min(used+1, size);
+
+                    for (std::size_t i{0}; i<used; i++)
+                        neighbor(origin);
+                    e += used;
+                }
+            }
+        }
+
     public:
-        explicit optimizer(double start_temp, double min_temp)
+        explicit optimizer(double start_temp, double min_temp, std::size_t speculation = 1,
+                random::engine gen = random::device_engine())
                 :start_temp_(validate_start_temp(min_temp, start_temp)), min_temp_(validate_min_temp(min_temp)),
-                 curr_temp_(start_temp) { }
+                 curr_temp_(start_temp), rand_prob_{0.0, 1.0, gen}, speculation_(validate_speculation(speculation)) { }
 
         void operator()(const config_t& init_config,
                 IResult<state_t> auto& result,
@@ -54,30 +134,12 @@ namespace trading::simulated_annealing {
 
             // frozen
             for (it_ = 0; curr_temp_>min_temp_; it_++) {
-                for (std::size_t e{0}; e<equilibrium(*this); e++) {
-                    auto candidate = objective(neighbor(curr_state_.config));
-
-                    if (result.compare(candidate, curr_state_)) {
-                        curr_state_ = candidate;
-                        (observers.better_accepted(*this), ...);
-
-                        if (constraints(curr_state_))
-                            if (result.compare(curr_state_, best_state_)) {
-                                best_state_ = curr_state_;
-                                result.update(best_state_);
-                            }
-                    }
-                    else {
-                        double diff = appraise(curr_state_, candidate);
-                        double threshold = std::exp(-diff/curr_temp_);
-                        assert(threshold>=0.0 && threshold<=1.0);
-
-                        if (rand_prob_()<threshold) {
-                            curr_state_ = candidate;
-                            (observers.worse_accepted(*this), ...);
-                        }
-                    }
-                }
+                if (speculation_>1 && copyable<decltype(neighbor)>)
+                    speculate(result, constraints, objective, neighbor, appraise, equilibrium(*this), observers...);
+                else
+                    for (std::size_t e{0}; e<equilibrium(*this); e++)
+                        try_accept(objective(neighbor(curr_state_.config)), result, constraints, appraise,
+                                observers...);
                 cool(*this);
                 (observers.cooled(*this), ...);
             }
@@ -99,6 +161,11 @@ namespace trading::simulated_annealing {
             return it_;
         }
 
+        std::size_t speculation() const
+        {
+            return speculation_;
+        }
+
         double start_temperature() const
         {
             return start_temp_;
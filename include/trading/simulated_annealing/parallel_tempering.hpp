@@ -0,0 +1,176 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_SIMULATED_ANNEALING_PARALLEL_TEMPERING_HPP
+#define BACKTESTING_SIMULATED_ANNEALING_PARALLEL_TEMPERING_HPP
+
+#include <cmath>
+#include <mutex>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <trading/random/generators.hpp>
+#include <trading/interface.hpp>
+
+namespace trading::simulated_annealing {
+    // Runs a Markov chain per temperature of the ladder on separate threads. After each sweep of steps
+    // the neighboring chains attempt to exchange their states, so the good states found by the hot chains
+    // descend to the cold ones. Each chain has its own neighbor and acceptance draws seeded from its stream
+    // of the engine, so a seeded run does not depend on the scheduling. The result and observers are shared
+    // under a lock.
+    template<class State>
+    class parallel_tempering {
+        using state_t = State;
+        using config_t = typename state_t::config_type;
+
+        struct chain {
+            double temp;
+            state_t curr_state;
+            random::engine gen;
+            random::real_interval_generator<double> rand_prob;
+            std::size_t exchange_count{0};
+        };
+
+        std::vector<chain> chains_;
+        std::size_t sweep_, it_{0};
+        state_t best_state_;
+        random::real_interval_generator<double> rand_prob_;
+
+        static std::vector<double> validate_temperatures(std::vector<double>&& temps)
+        {
+            if (temps.size()<2)
+                throw std::invalid_argument("At least two temperatures have to be provided");
+            if (temps.front()<=0.0)
+                throw std::invalid_argument("Temperatures have to be greater than 0");
+            for (std::size_t i{1}; i<temps.size(); i++)
+                if (temps[i]<=temps[i-1])
+                    throw std::invalid_argument("Temperatures have to be in ascending order");
+            return temps;
+        }
+
+        static std::size_t validate_sweep(std::size_t sweep)
+        {
+            if (!sweep)
+                throw std::invalid_argument("Sweep has to be greater than zero");
+            return sweep;
+        }
+
+    public:
+        // temperatures from the coldest, sweep is the number of steps of each chain between the exchanges,
+        // each chain draws from its own stream of the engine
+        parallel_tempering(std::vector<double> temps, std::size_t sweep, random::engine gen = random::device_engine())
+                :sweep_(validate_sweep(sweep)), rand_prob_{0.0, 1.0, gen.split(0)}
+        {
+            for (double temp: validate_temperatures(std::move(temps))) {
+                auto chain_gen = gen.split(chains_.size()+1);
+                chains_.emplace_back(chain{temp, state_t{}, chain_gen,
+                                           random::real_interval_generator<double>{0.0, 1.0, chain_gen.split(0)}});
+            }
+        }
+
+        // the neighbor of each chain is made by the factory from the stream of the chain
+        void operator()(const config_t& init_config,
+                IResult<state_t> auto& result,
+                IConstraints<state_t> auto&& constraints,
+                IObjectiveFunction<state_t> auto&& objective,
+                INeighborFactory<config_t> auto&& make_neighbor,
+                IAppraiser<state_t> auto&& appraise,
+                ITerminationCriteria<parallel_tempering> auto&& terminate,
+                ITemperingObserver<parallel_tempering> auto& ... observers)
+        {
+            best_state_ = objective(init_config);
+            std::vector<decltype(make_neighbor(std::declval<random::engine>()))> neighbors;
+            neighbors.reserve(chains_.size());
+            for (auto& chain: chains_) {
+                chain.curr_state = best_state_;
+                chain.exchange_count = 0;
+                neighbors.emplace_back(make_neighbor(chain.gen.split(1)));
+            }
+            std::mutex mutex;
+            (observers.started(*this), ...);
+
+            for (it_ = 0; !terminate(*this); it_++) {
+                #pragma omp parallel for num_threads(chains_.size()) schedule(static, 1)
+                for (std::size_t c = 0; c<chains_.size(); c++) {
+                    auto& chain = chains_[c];
+                    auto& neighbor = neighbors[c];
+
+                    for (std::size_t s{0}; s<sweep_; s++) {
+                        auto candidate = objective(neighbor(chain.curr_state.config));
+
+                        if (result.compare(candidate, chain.curr_state)) {
+                            chain.curr_state = candidate;
+                            std::lock_guard lock{mutex};
+                            (observers.better_accepted(*this, c), ...);
+
+                            if (constraints(candidate) && result.compare(candidate, best_state_)) {
+                                best_state_ = candidate;
+                                result.update(best_state_);
+                            }
+                        }
+                        else if (chain.rand_prob()<std::exp(-appraise(chain.curr_state, candidate)/chain.temp)) {
+                            chain.curr_state = candidate;
+                            std::lock_guard lock{mutex};
+                            (observers.worse_accepted(*this, c), ...);
+                        }
+                    }
+                }
+
+                // even and odd pairs alternate, accepted when the hotter state is better or with the probability
+                // given by the difference of the inverse temperatures
+                for (std::size_t c{it_%2}; c+1<chains_.size(); c += 2) {
+                    auto& cold = chains_[c];
+                    auto& hot = chains_[c+1];
+                    double exponent = (1.0/cold.temp-1.0/hot.temp)*appraise(hot.curr_state, cold.curr_state);
+
+                    if (exponent>=0.0 || rand_prob_()<std::exp(exponent)) {
+                        std::swap(cold.curr_state, hot.curr_state);
+                        cold.exchange_count++;
+                        (observers.exchanged(*this, c), ...);
+                    }
+                }
+                (observers.iteration_passed(*this), ...);
+            }
+            (observers.finished(*this), ...);
+        }
+
+        std::size_t chain_count() const
+        {
+            return chains_.size();
+        }
+
+        double temperature(std::size_t chain) const
+        {
+            return chains_[chain].temp;
+        }
+
+        const state_t& current_state(std::size_t chain) const
+        {
+            return chains_[chain].curr_state;
+        }
+
+        // number of exchanges between the chain and the next hotter one
+        std::size_t exchange_count(std::size_t chain) const
+        {
+            return chains_[chain].exchange_count;
+        }
+
+        const state_t& best_state() const
+        {
+            return best_state_;
+        }
+
+        std::size_t it() const
+        {
+            return it_;
+        }
+
+        std::size_t sweep() const
+        {
+            return sweep_;
+        }
+    };
+}
+
+#endif //BACKTESTING_SIMULATED_ANNEALING_PARALLEL_TEMPERING_HPP
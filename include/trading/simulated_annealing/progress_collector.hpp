@@ -44,6 +44,27 @@ namespace trading::simulated_annealing {
             reset_counters();
         }
 
+        // parallel tempering, one progress per chain from the coldest
+        template<class Optimizer>
+        void better_accepted(const Optimizer&, std::size_t) { }
+
+        template<class Optimizer>
+        void worse_accepted(const Optimizer&, std::size_t) { }
+
+        template<class Optimizer>
+        void exchanged(const Optimizer&, std::size_t) { }
+
+        template<class Optimizer>
+        void iteration_passed(const Optimizer& optimizer)
+        {
+            for (std::size_t c{0}; c<optimizer.chain_count(); c++) {
+                progress_.back().curr_state_value = optimizer.current_state(c).value;
+                progress_.back().best_state_value = optimizer.best_state().value;
+                progress_.back().temperature = optimizer.temperature(c);
+                reset_counters();
+            }
+        }
+
         template<class Optimizer>
         void finished(const Optimizer&)
         {
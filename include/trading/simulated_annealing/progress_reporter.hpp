@@ -34,6 +34,26 @@ namespace trading::simulated_annealing {
                      << optimizer.best_state().value << std::endl;
         }
 
+        template<class Optimizer>
+        void better_accepted(const Optimizer&, std::size_t) { }
+
+        template<class Optimizer>
+        void worse_accepted(const Optimizer&, std::size_t) { }
+
+        template<class Optimizer>
+        void exchanged(const Optimizer&, std::size_t) { }
+
+        template<class Optimizer>
+        void iteration_passed(const Optimizer& optimizer)
+        {
+            *logger_ << "it: " << optimizer.it() << ", best value: " << optimizer.best_state().value;
+            for (std::size_t c{0}; c<optimizer.chain_count(); c++)
+                *logger_ << ", chain " << c << " (temperature: " << optimizer.temperature(c)
+                         << ", curr value: " << optimizer.current_state(c).value
+                         << ", exchanges: " << optimizer.exchange_count(c) << ")";
+            *logger_ << std::endl;
+        }
+
         template<class Optimizer>
         void finished(const Optimizer&) { }
     };
@@ -11,8 +11,11 @@
 #include <trading/ema.hpp>
 #include <trading/data_point.hpp>
 #include <trading/candle.hpp>
+#include <trading/interface.hpp>
 #include <trading/motion_tracker.hpp>
 #include <trading/resampler.hpp>
+#include <trading/time_resampler.hpp>
+#include <trading/candle_pyramid.hpp>
 #include <trading/statistics.hpp>
 #include <trading/action.hpp>
 #include <trading/data_point.hpp>
@@ -21,9 +24,42 @@ namespace trading {
     class simulator {
         std::vector<price_point> prices_;
         std::vector<price_t> indic_prices_;
+        std::vector<index_t> indic_ends_;
+        std::vector<index_t> run_ends_;
         std::size_t resampling_period_;
         amount_t min_equity_;
 
+        template<class Trader, class... Observer>
+        void simulate_runs(Trader& trader, Observer& ... observers)
+        {
+            std::size_t indic_idx{0};
+            index_t begin{0};
+
+            (observers.started(trader, prices_.front()), ...);
+            for (index_t end: run_ends_) {
+                for (index_t i{begin}; i<end; i++) {
+                    if (!(trader.equity(prices_[i].data)>min_equity_)) {
+                        (observers.finished(trader, prices_.back()), ...);
+                        return;
+                    }
+                    action done = trader(prices_[i]);
+                    (observers.decided(trader, done, prices_[i]), ...);
+
+                    if (trader.position_active())
+                        (observers.position_active(trader, prices_[i]), ...);
+
+                    if (done==action::none) break;
+                }
+
+                // runs are split after each indicator update
+                if (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==end-1)
+                    if (trader.update_indicators(indic_prices_[indic_idx++]))
+                        (observers.indicators_updated(trader, prices_[end-1]), ...);
+                begin = end;
+            }
+            (observers.finished(trader, prices_.back()), ...);
+        }
+
     public:
         simulator(const std::vector<candle>& candles, std::size_t resampling_period,
                 IAverager auto&& averager, amount_t min_equity)
@@ -34,34 +70,109 @@ namespace trading {
             candle indic_candle;
             prices_.reserve(candles.size());
             indic_prices_.reserve(candles.size()/resampling_period_);
+            indic_ends_.reserve(candles.size()/resampling_period_);
 
-            for (const auto& candle: candles) {
-                prices_.emplace_back(price_point{candle.opened(), candle.close()});
+            for (index_t i{0}; i<candles.size(); i++) {
+                prices_.emplace_back(price_point{candles[i].opened(), candles[i].close()});
 
-                if (resampler(candle, indic_candle))
+                if (resampler(candles[i], indic_candle)) {
                     indic_prices_.emplace_back(averager(indic_candle));
+                    indic_ends_.emplace_back(i);
+                }
             }
         }
 
+        // resamples by wall-clock time, so gaps in candles do not shift the following indicator updates
+        simulator(const std::vector<candle>& candles, const time_resampler& resampler,
+                IAverager auto&& averager, amount_t min_equity)
+                :resampling_period_(resampler.candle_count()), min_equity_{min_equity}
+        {
+            assert(candles.size());
+            prices_.reserve(candles.size());
+            for (const auto& candle: candles)
+                prices_.emplace_back(price_point{candle.opened(), candle.close()});
+
+            auto resampled = resampler(candles);
+            indic_prices_.reserve(resampled.size());
+            indic_ends_.reserve(resampled.size());
+
+            for (const auto& bucket: resampled) {
+                indic_prices_.emplace_back(averager(bucket.value));
+                indic_ends_.emplace_back(bucket.last);
+            }
+        }
+
+        // uses a timeframe of the candle pyramid built from the same candles
+        simulator(const std::vector<candle>& candles, const timeframe& frame, std::time_t candle_period,
+                IAverager auto&& averager, amount_t min_equity)
+                :resampling_period_(frame.period/candle_period), min_equity_{min_equity}
+        {
+            assert(candles.size());
+            prices_.reserve(candles.size());
+            for (const auto& candle: candles)
+                prices_.emplace_back(price_point{candle.opened(), candle.close()});
+
+            indic_prices_.reserve(frame.candles.size());
+            for (const auto& candle: frame.candles)
+                indic_prices_.emplace_back(averager(candle));
+            indic_ends_ = frame.ends;
+        }
+
+        // Collapses runs of equal prices, that are not split by an indicator update. The simulation
+        // then skips the rest of a run once a tick makes no decision, as the following ticks cannot
+        // change the state. Observers do not see the skipped ticks, which leaves the statistics unchanged.
+        void compact()
+        {
+            if (compacted()) return;
+            for (index_t i{1}, indic_idx{0}; i<=prices_.size(); i++) {
+                while (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]<i-1) indic_idx++;
+                bool updated = indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==i-1;
+                if (i==prices_.size() || updated || prices_[i].data!=prices_[i-1].data)
+                    run_ends_.emplace_back(i);
+            }
+        }
+
+        bool compacted() const
+        {
+            return !run_ends_.empty();
+        }
+
+        // average number of ticks per run
+        double compression_ratio() const
+        {
+            return compacted() ? static_cast<double>(prices_.size())/static_cast<double>(run_ends_.size()) : 1.0;
+        }
+
         template<class Trader, class... Observer>
         void operator()(Trader&& trader, Observer& ... observers)
         {
-            auto indic_prices_it = indic_prices_.begin();
+            if (compacted()) {
+                simulate_runs(trader, observers...);
+                return;
+            }
+            std::size_t indic_idx{0};
 
             (observers.started(trader, prices_.front()), ...);
             for (std::size_t i{0}; i<prices_.size() && trader.equity(prices_[i].data)>min_equity_; i++) {
-                (observers.decided(trader, trader(prices_[i]), prices_[i]), ...);
+                action done = trader(prices_[i]);
+                (observers.decided(trader, done, prices_[i]), ...);
 
                 if (trader.position_active())
                     (observers.position_active(trader, prices_[i]), ...);
 
-                if (i && (i+1)%resampling_period_==0)
-                    if (trader.update_indicators((*indic_prices_it++)))
+                if (indic_idx<indic_ends_.size() && indic_ends_[indic_idx]==i)
+                    if (trader.update_indicators(indic_prices_[indic_idx++]))
                         (observers.indicators_updated(trader, prices_[i]), ...);
             }
             (observers.finished(trader, prices_.back()), ...);
         }
 
+        // indices of prices after the end of each run, empty when not compacted
+        const std::vector<index_t>& run_ends() const
+        {
+            return run_ends_;
+        }
+
         const std::vector<price_point>& prices() const
         {
             return prices_;
@@ -72,6 +183,12 @@ namespace trading {
             return indic_prices_;
         }
 
+        // indices of prices after which the indicators are updated
+        const std::vector<index_t>& indicator_ends() const
+        {
+            return indic_ends_;
+        }
+
         std::size_t resampling_period() const
         {
             return resampling_period_;
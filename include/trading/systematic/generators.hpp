@@ -5,10 +5,24 @@
 #ifndef BACKTESTING_SYSTEMATIC_GENERATORS_HPP
 #define BACKTESTING_SYSTEMATIC_GENERATORS_HPP
 
+#include <array>
+#include <vector>
+#include <stdexcept>
 #include <trading/generators.hpp>
 #include <trading/int_range.hpp>
 
 namespace trading::systematic {
+    // number of k-element subsets of n elements
+    constexpr std::size_t binomial(std::size_t n, std::size_t k)
+    {
+        if (k>n) return 0;
+        k = std::min(k, n-k);
+        std::size_t res{1};
+        for (std::size_t i{1}; i<=k; i++)
+            res = res*(n-k+i)/i;
+        return res;
+    }
+
     // generates unique subsequent fractions in interval (0, max), such as max is in interval (0.0, 1.0]
     template<std::size_t n_levels>
     class levels_generator : public trading::levels_generator<n_levels> {
@@ -25,7 +39,57 @@ namespace trading::systematic {
             co_yield generate<0>(this->unscaled_denom());
         }
 
+        // the levels are the descending subsets of the unscaled numerators,
+        // each numerator followed by the subsets of the smaller ones
+        std::size_t value_count() const
+        {
+            return binomial(this->unique_count_, n_levels);
+        }
+
+        // levels generated at the index, without generating the previous ones
+        value_type at(std::size_t index) const
+        {
+            if (index>=value_count())
+                throw std::out_of_range("Index of levels is out of range");
+
+            value_type levels;
+            std::size_t num{this->unscaled_denom()};
+            for (std::size_t depth{0}; depth<n_levels; depth++) {
+                std::size_t remaining{n_levels-depth-1};
+                for (num--; index>=binomial(num-1, remaining); num--)
+                    index -= binomial(num-1, remaining);
+                levels[depth] = this->rescale(num);
+            }
+            return levels;
+        }
+
+        // index at which the levels are generated
+        std::size_t index_of(const value_type& levels) const
+        {
+            std::size_t index{0}, prev_num{this->unscaled_denom()};
+            for (std::size_t depth{0}; depth<n_levels; depth++) {
+                std::size_t num = unscale(levels[depth]), remaining{n_levels-depth-1};
+                if (num>=prev_num || num<=remaining)
+                    throw std::invalid_argument("Levels are not generated by the generator");
+                for (std::size_t skipped{prev_num-1}; skipped>num; skipped--)
+                    index += binomial(skipped-1, remaining);
+                prev_num = num;
+            }
+            return index;
+        }
+
     private:
+        std::size_t unscale(const fraction_t& level) const
+        {
+            const auto& bound = this->lower_bound_;
+            std::size_t offset{bound.numerator()*this->unscaled_denom()}, step{bound.denominator()-bound.numerator()};
+            std::size_t num = (level.numerator()>offset) ? (level.numerator()-offset)/step : 0;
+            if (num<1 || num>this->unique_count_ || this->rescale(num).numerator()!=level.numerator() ||
+                    this->rescale(num).denominator()!=level.denominator())
+                throw std::invalid_argument("Levels are not generated by the generator");
+            return num;
+        }
+
         template<std::size_t depth = n_levels>
         requires (depth==n_levels)
         cppcoro::recursive_generator<value_type> generate(std::size_t) { co_yield this->levels_; }
@@ -48,7 +112,18 @@ namespace trading::systematic {
         using base_type = trading::sizes_generator<n_sizes>;
 
         sizes_generator(size_t unique_count = base_type::default_unique_count)
-                :trading::sizes_generator<n_sizes>(unique_count) { }
+                :trading::sizes_generator<n_sizes>(unique_count)
+        {
+            // counts_[parts][remaining] is the number of ways to split the remaining numerator into the parts
+            for (auto& counts: counts_)
+                counts.assign(this->denom_+1, 0);
+            for (std::size_t remaining{1}; remaining<=this->max_num_; remaining++)
+                counts_[1][remaining] = 1;
+            for (std::size_t parts{2}; parts<=n_sizes; parts++)
+                for (std::size_t remaining{parts}; remaining<=this->denom_; remaining++)
+                    for (std::size_t num{1}; num<=std::min(this->max_num_, remaining-1); num++)
+                        counts_[parts][remaining] += counts_[parts-1][remaining-num];
+        }
 
         using value_type = typename base_type::value_type;
 
@@ -57,7 +132,58 @@ namespace trading::systematic {
             co_yield generate<0>(this->denom_);
         }
 
+        std::size_t value_count() const
+        {
+            return counts_[n_sizes][this->denom_];
+        }
+
+        // sizes generated at the index, without generating the previous ones
+        value_type at(std::size_t index) const
+        {
+            if (index>=value_count())
+                throw std::out_of_range("Index of sizes is out of range");
+
+            value_type sizes;
+            std::size_t remaining{this->denom_};
+            for (std::size_t depth{0}; depth+1<n_sizes; depth++) {
+                std::size_t num{1}, parts{n_sizes-depth-1};
+                for (; index>=counts_[parts][remaining-num]; num++)
+                    index -= counts_[parts][remaining-num];
+                sizes[depth] = fraction_t{num, this->denom_};
+                remaining -= num;
+            }
+            sizes[n_sizes-1] = fraction_t{remaining, this->denom_};
+            return sizes;
+        }
+
+        // index at which the sizes are generated
+        std::size_t index_of(const value_type& sizes) const
+        {
+            std::size_t index{0}, remaining{this->denom_};
+            for (std::size_t depth{0}; depth+1<n_sizes; depth++) {
+                std::size_t num = unscale(sizes[depth]), parts{n_sizes-depth-1};
+                if (num>=remaining)
+                    throw std::invalid_argument("Sizes are not generated by the generator");
+                for (std::size_t skipped{1}; skipped<num; skipped++)
+                    index += counts_[parts][remaining-skipped];
+                remaining -= num;
+            }
+            if (unscale(sizes[n_sizes-1])!=remaining)
+                throw std::invalid_argument("Sizes are not generated by the generator");
+            return index;
+        }
+
     private:
+        std::array<std::vector<std::size_t>, n_sizes+1> counts_;
+
+        std::size_t unscale(const fraction_t& size) const
+        {
+            std::size_t num = size.numerator();
+            if (num<1 || num>this->max_num_ || size.denominator()!=this->denom_)
+                throw std::invalid_argument("Sizes are not generated by the generator");
+            return num;
+        }
+
         template<std::size_t depth = n_sizes>
         requires (depth+1==n_sizes)
         cppcoro::recursive_generator<value_type> generate(std::size_t remaining)
@@ -81,6 +207,16 @@ namespace trading::systematic {
     class int_range_generator : public trading::int_range {
         using base_type = trading::int_range;
 
+        // the value has to be in the range and a whole number of steps from the start
+        int validate_value(int val) const
+        {
+            int offset = val-this->from_;
+            if (offset%this->step_ || offset/this->step_<0 ||
+                    static_cast<std::size_t>(offset/this->step_)>=this->n_vals_)
+                throw std::invalid_argument("Value is not generated by the generator");
+            return val;
+        }
+
     public:
         using value_type = base_type::value_type;
 
@@ -92,6 +228,18 @@ namespace trading::systematic {
             for (int val{this->from_}; val!=this->to_+this->step_; val += this->step_)
                 co_yield val;
         }
+
+        value_type at(std::size_t index) const
+        {
+            if (index>=this->n_vals_)
+                throw std::out_of_range("Index of value is out of range");
+            return this->from_+static_cast<int>(index)*this->step_;
+        }
+
+        std::size_t index_of(value_type val) const
+        {
+            return static_cast<std::size_t>((validate_value(val)-this->from_)/this->step_);
+        }
     };
 }
 
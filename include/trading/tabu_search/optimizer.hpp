@@ -5,24 +5,44 @@
 #ifndef BACKTESTING_TABU_SEARCH_OPTIMIZER_HPP
 #define BACKTESTING_TABU_SEARCH_OPTIMIZER_HPP
 
+#include <vector>
+#include <stdexcept>
 #include <unordered_map>
 #include <trading/state.hpp>
 #include <trading/interface.hpp>
 
 namespace trading::tabu_search {
+    // The neighborhood is generated up front and evaluated by the objective in parallel, so it has to be
+    // thread safe. The move is then selected in the order of generation, as for any number of threads.
     template<class State, class Move, ITabuList<Move> TabuList>
     class optimizer {
         TabuList tabu_list_;
         State best_state_, curr_state_;
-        Move curr_move_, candidate_move_;
-        std::size_t it_{0};
+        Move curr_move_;
+        std::size_t it_{0}, thread_count_;
         using state_t = State;
         using config_t = typename state_t::config_type;
         using move_t = Move;
+        std::vector<state_t> candidates_;
+        std::vector<move_t> candidate_moves_;
+
+        static std::size_t validate_thread_count(std::size_t thread_count)
+        {
+            if (!thread_count)
+                throw std::invalid_argument("Thread count has to be greater than zero");
+            return thread_count;
+        }
+
+        static std::size_t validate_neighborhood_size(std::size_t size)
+        {
+            if (!size)
+                throw std::invalid_argument("Neighborhood size has to be greater than zero");
+            return size;
+        }
 
     public:
-        explicit optimizer(TabuList tabu_list)
-                :tabu_list_(tabu_list) { }
+        explicit optimizer(TabuList tabu_list, std::size_t thread_count = 1)
+                :tabu_list_(tabu_list), thread_count_(validate_thread_count(thread_count)) { }
 
         void operator()(const config_t& init,
                 IResult<state_t> auto& result,
@@ -35,23 +55,32 @@ namespace trading::tabu_search {
                 IObserver<optimizer> auto& ... observers)
         {
             best_state_ = curr_state_ = objective(init);
-            state_t candidate, origin;
+            state_t origin;
 
             (observers.started(*this), ...);
             for (it_ = 0; !terminate(*this); it_++) {
-                // explore neighborhood
+                // generate neighborhood
                 origin = curr_state_;
-                std::tie(curr_state_.config, curr_move_) = neighbor(origin.config);
-                curr_state_ = objective(curr_state_.config);
+                std::size_t size = validate_neighborhood_size(neighborhood(*this));
+                candidates_.resize(size);
+                candidate_moves_.resize(size);
+                for (std::size_t i{0}; i<size; i++)
+                    std::tie(candidates_[i].config, candidate_moves_[i]) = neighbor(origin.config);
+
+                // explore neighborhood
+                #pragma omp parallel for num_threads(thread_count_) schedule(dynamic)
+                for (std::size_t i = 0; i<size; i++)
+                    candidates_[i] = objective(candidates_[i].config);
 
-                for (std::size_t i{0}; i<neighborhood(*this)-1; i++) {
-                    std::tie(candidate.config, candidate_move_) = neighbor(origin.config);
-                    candidate = objective(candidate.config);
+                curr_state_ = candidates_[0];
+                curr_move_ = candidate_moves_[0];
+                for (std::size_t i{1}; i<size; i++) {
+                    const auto& candidate = candidates_[i];
 
-                    if ((!tabu_list_.contains(candidate_move_) && result.compare(candidate, curr_state_))
+                    if ((!tabu_list_.contains(candidate_moves_[i]) && result.compare(candidate, curr_state_))
                         || aspire(candidate, *this)) {
                         curr_state_ = candidate;
-                        curr_move_ = candidate_move_;
+                        curr_move_ = candidate_moves_[i];
                     }
                 }
 
@@ -88,6 +117,11 @@ namespace trading::tabu_search {
         {
             return it_;
         }
+
+        std::size_t thread_count() const
+        {
+            return thread_count_;
+        }
     };
 }
 
@@ -0,0 +1,151 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TICK_AGGREGATOR_HPP
+#define BACKTESTING_TICK_AGGREGATOR_HPP
+
+#include <limits>
+#include <vector>
+#include <optional>
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <fmt/format.h>
+#include <trading/types.hpp>
+#include <trading/candle.hpp>
+#include <trading/candle_validator.hpp>
+
+namespace trading {
+    // trades stored by column, so the prices of a bucket can be reduced with vector instructions
+    struct tick_columns {
+        std::vector<std::time_t> time;
+        std::vector<price_t> price;
+        std::vector<amount_t> quantity;
+
+        void reserve(std::size_t size)
+        {
+            time.reserve(size);
+            price.reserve(size);
+            quantity.reserve(size);
+        }
+
+        void emplace_back(std::time_t time_val, price_t price_val, amount_t quantity_val)
+        {
+            time.emplace_back(time_val);
+            price.emplace_back(price_val);
+            quantity.emplace_back(quantity_val);
+        }
+
+        void clear()
+        {
+            time.clear();
+            price.clear();
+            quantity.clear();
+        }
+
+        std::size_t size() const
+        {
+            return time.size();
+        }
+    };
+
+    // Aggregates chronologically ordered trades into candles of the period in a single streaming pass.
+    // The trades can arrive in batches of any size, the candle of the last bucket is only emitted when
+    // a trade of a later bucket arrives or on finish. Buckets without trades produce no candle.
+    class tick_aggregator {
+        std::time_t period_, offset_;
+        std::optional<candle> bucket_;
+        std::optional<std::time_t> last_time_;
+
+        static std::time_t validate_period(std::time_t period)
+        {
+            if (period<=0)
+                throw std::invalid_argument("Period has to be greater than 0");
+            return period;
+        }
+
+        std::time_t bucket_opened(std::time_t time) const
+        {
+            std::time_t shifted = time-offset_;
+            std::time_t floored = shifted/period_-(shifted%period_<0);
+            return floored*period_+offset_;
+        }
+
+        static void emit(const candle& bucket, candle_columns& out)
+        {
+            out.emplace_back(bucket.opened(), bucket.open(), bucket.high(), bucket.low(), bucket.close());
+        }
+
+        // trades out of order within the batch or before the last trade of the previous batch
+        void validate_order(const std::time_t* times, std::size_t size) const
+        {
+            if (!size) return;
+            if (last_time_ && times[0]<*last_time_)
+                throw std::invalid_argument(fmt::format("Trade at {} is out of order", times[0]));
+
+            auto unordered = std::adjacent_find(times, times+size, std::greater<>{});
+            if (unordered!=times+size)
+                throw std::invalid_argument(fmt::format("Trade at {} is out of order", *(unordered+1)));
+        }
+
+    public:
+        explicit tick_aggregator(std::time_t period, std::time_t offset = 0)
+                :period_(validate_period(period)), offset_(offset) { }
+
+        // appends the candles completed by the trades to the output, nothing is appended when out of order
+        void operator()(const tick_columns& ticks, candle_columns& out)
+        {
+            const std::size_t size = ticks.size();
+            const std::time_t* times = ticks.time.data();
+            const price_t* prices = ticks.price.data();
+            validate_order(times, size);
+            if (size) last_time_ = times[size-1];
+
+            for (std::size_t begin{0}; begin<size;) {
+                std::time_t opened = bucket_opened(times[begin]);
+                std::time_t closed = opened+period_;
+
+                std::size_t end{begin+1};
+                while (end<size && times[end]<closed) end++;
+
+                price_t high{std::numeric_limits<price_t>::lowest()}, low{std::numeric_limits<price_t>::max()};
+                #pragma omp simd reduction(max:high) reduction(min:low)
+                for (std::size_t i = begin; i<end; i++) {
+                    high = std::max(high, prices[i]);
+                    low = std::min(low, prices[i]);
+                }
+
+                if (bucket_ && bucket_->opened()==opened) {
+                    bucket_ = candle{candle::trusted, opened, bucket_->open(), std::max(bucket_->high(), high),
+                                     std::min(bucket_->low(), low), prices[end-1]};
+                }
+                else {
+                    if (bucket_) emit(*bucket_, out);
+                    bucket_ = candle{candle::trusted, opened, prices[begin], high, low, prices[end-1]};
+                }
+                begin = end;
+            }
+        }
+
+        // appends the candle of the last bucket
+        void finish(candle_columns& out)
+        {
+            if (bucket_) emit(*bucket_, out);
+            bucket_.reset();
+            last_time_.reset();
+        }
+
+        std::time_t period() const
+        {
+            return period_;
+        }
+
+        std::time_t offset() const
+        {
+            return offset_;
+        }
+    };
+}
+
+#endif //BACKTESTING_TICK_AGGREGATOR_HPP
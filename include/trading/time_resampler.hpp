@@ -0,0 +1,166 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TIME_RESAMPLER_HPP
+#define BACKTESTING_TIME_RESAMPLER_HPP
+
+#include <vector>
+#include <limits>
+#include <optional>
+#include <algorithm>
+#include <trading/types.hpp>
+#include <trading/candle.hpp>
+
+namespace trading {
+    struct resampled_candle {
+        candle value;
+        index_t last;       // index of the last input candle of the bucket
+        std::size_t count;  // number of input candles in the bucket
+    };
+
+    // Buckets candles by wall-clock period aligned to the epoch shifted by offset (all in seconds).
+    // Missing candles do not shift the following buckets, the bucket just contains fewer candles.
+    class time_resampler {
+        std::time_t period_, candle_period_, offset_;
+
+        static std::time_t validate_candle_period(std::time_t candle_period)
+        {
+            if (candle_period<=0)
+                throw std::invalid_argument("Candle period has to be greater than 0");
+            return candle_period;
+        }
+
+        static std::time_t validate_period(std::time_t period, std::time_t candle_period)
+        {
+            if (period<candle_period || period%candle_period)
+                throw std::invalid_argument("Resampling period has to be a multiple of candle period");
+            return period;
+        }
+
+        candle aggregate(const std::vector<candle>& in, index_t first, index_t last) const
+        {
+            price_t low{std::numeric_limits<price_t>::max()}, high{std::numeric_limits<price_t>::lowest()};
+
+            #pragma omp simd reduction(min:low) reduction(max:high)
+            for (index_t i = first; i<=last; i++) {
+                low = std::min(low, in[i].low());
+                high = std::max(high, in[i].high());
+            }
+            return candle{bucket_opened(in[first].opened()), in[first].open(), high, low, in[last].close()};
+        }
+
+    public:
+        explicit time_resampler(std::time_t period, std::time_t candle_period = 60, std::time_t offset = 0)
+                :period_(validate_period(period, validate_candle_period(candle_period))),
+                 candle_period_(candle_period), offset_(offset) { }
+
+        std::time_t bucket_opened(std::time_t opened) const
+        {
+            std::time_t shift = (opened-offset_)%period_;
+            if (shift<0) shift += period_;
+            return opened-shift;
+        }
+
+        // Returns buckets in chronological order, candles have to be sorted by opening time.
+        // The last bucket is left out if it is not complete yet.
+        std::vector<resampled_candle> operator()(const std::vector<candle>& in) const
+        {
+            std::vector<resampled_candle> out;
+            if (in.empty()) return out;
+            out.reserve(in.size()*candle_period_/period_+1);
+
+            index_t first{0};
+            std::time_t curr_opened{bucket_opened(in.front().opened())};
+
+            for (index_t i{1}; i<=in.size(); i++) {
+                if (i<in.size() && bucket_opened(in[i].opened())==curr_opened) continue;
+
+                bool closed = i<in.size() || in[i-1].opened()+candle_period_>=curr_opened+period_;
+                if (closed)
+                    out.emplace_back(resampled_candle{aggregate(in, first, i-1), i-1, i-first});
+
+                if (i<in.size()) {
+                    first = i;
+                    curr_opened = bucket_opened(in[i].opened());
+                }
+            }
+            return out;
+        }
+
+        bool complete(const resampled_candle& bucket) const
+        {
+            return bucket.count==candle_count();
+        }
+
+        // number of candles in a complete bucket
+        std::size_t candle_count() const
+        {
+            return period_/candle_period_;
+        }
+
+        std::time_t period() const
+        {
+            return period_;
+        }
+
+        std::time_t candle_period() const
+        {
+            return candle_period_;
+        }
+
+        std::time_t offset() const
+        {
+            return offset_;
+        }
+    };
+    // Resamples candles one by one as they arrive, the same as time_resampler.
+    // A bucket is closed either by its last candle or by a candle of a later bucket.
+    class live_resampler {
+        time_resampler resampler_;
+        std::optional<candle> bucket_;
+
+    public:
+        explicit live_resampler(const time_resampler& resampler)
+                :resampler_(resampler) { }
+
+        // adds the candle, returns the previous bucket when the candle opens a new one
+        std::optional<candle> add(const candle& curr)
+        {
+            std::optional<candle> closed;
+            std::time_t opened = resampler_.bucket_opened(curr.opened());
+
+            if (bucket_ && bucket_->opened()!=opened) {
+                closed = bucket_;
+                bucket_.reset();
+            }
+
+            if (bucket_) {
+                bucket_ = candle{candle::trusted, opened, bucket_->open(), std::max(bucket_->high(), curr.high()),
+                                 std::min(bucket_->low(), curr.low()), curr.close()};
+            }
+            else {
+                bucket_ = candle{candle::trusted, opened, curr.open(), curr.high(), curr.low(), curr.close()};
+            }
+            return closed;
+        }
+
+        // returns the bucket when the last added candle completed it
+        std::optional<candle> complete(const candle& last)
+        {
+            std::optional<candle> closed;
+            if (bucket_ && last.opened()+resampler_.candle_period()>=bucket_->opened()+resampler_.period()) {
+                closed = bucket_;
+                bucket_.reset();
+            }
+            return closed;
+        }
+
+        const time_resampler& resampler() const
+        {
+            return resampler_;
+        }
+    };
+}
+
+#endif //BACKTESTING_TIME_RESAMPLER_HPP
@@ -4,9 +4,12 @@
 #include <filesystem>
 #include <set>
 #include <list>
+#include <deque>
+#include <algorithm>
 #include <utility>
 #include <memory>
 #include <array>
+#include <thread>
 #include <trading.hpp>
 #include <fmt/format.h>
 #include <nlohmann/json.hpp>
@@ -21,6 +24,10 @@ using logger_t = tee_stream_type;
 using json = nlohmann::json;
 using namespace trading;
 
+// market of the backtests, it is saved to the settings, so the paper trading uses the same one
+const fraction_t market_fee{1, 100};   // 1 %
+constexpr amount_t init_balance{10'000}, min_equity{5'000};
+
 template<std::size_t n_levels>
 auto create_trader(const bazooka::configuration<n_levels>& config)
 {
@@ -35,30 +42,40 @@ auto create_trader(const bazooka::configuration<n_levels>& config)
     bazooka::strategy strategy{indic, indic, config.levels};
 
     // create manager
-    fraction_t fee{1, 100};   // 1 %
-    amount_t init_balance{10'000};
-    trading::market market{wallet{init_balance}, fee, fee};
+    trading::market market{wallet{init_balance}, market_fee, market_fee};
     order_sizer open_sizer{config.sizes};
     bazooka::manager manager{market, open_sizer};
 
     return trading::bazooka::trader{strategy, manager};
 }
 
-auto read_candles(const std::filesystem::path& path, char sep,
+// the plain csv file is preferred, then its zstd and gzip compressed variants
+std::filesystem::path find_candles(const std::filesystem::path& dir, const std::string& name)
+{
+    for (const auto& extension: {".csv", ".csv.zst", ".csv.gz"}) {
+        std::filesystem::path path{dir/(name+extension)};
+        if (std::filesystem::exists(path)) return path;
+    }
+    return dir/(name+".csv");
+}
+
+auto read_candles(const std::filesystem::path& path, char sep, validation_report& report,
         std::time_t min_opened = std::numeric_limits<std::time_t>::min(),
         std::time_t max_opened = std::numeric_limits<std::time_t>::max())
 {
-    io::csv::reader<5> reader{path, sep};
+    io::csv::reader<5, io::compressed_ifstream> reader{path, sep};
     std::time_t opened;
     price_t open, high, low, close;
-    std::vector<candle> candles;
+    candle_columns columns;
 
     // read rows
     while (reader.read_row(opened, open, high, low, close))
         if (opened>=min_opened && opened<=max_opened)
-            candles.emplace_back(candle{opened, open, high, low, close});
+            columns.emplace_back(opened, open, high, low, close);
 
-    return candles;
+    // validate and drop bad rows at once
+    candle_validator validator{std::chrono::seconds(std::chrono::minutes(1)).count(), cleaning_policy::drop};
+    return validator(columns, report);
 }
 
 template<typename CharType>
@@ -146,18 +163,35 @@ enum class optimizer_tag {
     genetic_algorithm,
     simulated_annealing,
     tabu_search,
+    parallel_tempering,
 };
 
-std::array<std::string, 4> optimizer_names{
+std::array<std::string, 5> optimizer_names{
         {
                 "brute force",
                 "genetic algorithm",
                 "simulated annealing",
                 "tabu search",
+                "parallel tempering",
         }
 };
 
-int main()
+// streams of the run seed drawn by the components
+enum class stream_tag : std::uint64_t {
+    levels,
+    sizes,
+    period,
+    neighbor,
+    optimizer,
+    selection,
+    matchmaker,
+    crossover,
+    genes,
+};
+
+// optionally takes the index and the count of the brute force workers sharing the output directory,
+// the seed of the run and the memory budget of the crossing bitmaps of all phases in MiB
+int main(int argc, char* argv[])
 {
     constexpr std::size_t n_levels{3};
     using state_t = trading::bazooka::state<n_levels>;
@@ -166,6 +200,13 @@ int main()
     std::string experiment_set_name = "remove";
     auto optim_tag = optimizer_tag::genetic_algorithm;
     auto optimizer_name = optimizer_names[trading::to_underlying(optim_tag)];
+    std::size_t worker_index = (argc>1) ? std::stoul(argv[1]) : 0;
+    std::size_t worker_count = (argc>2) ? std::stoul(argv[2]) : 1;
+    std::uint64_t seed = (argc>3) ? std::stoull(argv[3]) : random::device_seed();
+    std::size_t bitmaps_budget_mib = (argc>4) ? std::stoul(argv[4]) : 0;
+    auto stream = [&](stream_tag tag) {
+        return random::engine{seed}.split(trading::to_underlying(tag));
+    };
 
     std::vector<currency_pair> pairs{
 // white box
@@ -194,16 +235,18 @@ int main()
         std::filesystem::path experiment_dir{set_dir/pair.base};
         std::filesystem::create_directory(experiment_dir);
 
-        // create logger
-        std::ofstream log_file{experiment_dir/"log.txt"};
+        // create logger, each worker has its own log
+        std::ofstream log_file{experiment_dir/fmt::format("log-{}.txt", worker_index)};
         auto logger = std::make_shared<logger_t>(tee_type{std::cout, log_file});
 
         // read candles
-        std::filesystem::path candles_path{in_dir/fmt::format("{}{}.csv", pair.base, pair.quote)};
+        auto candles_path = find_candles(in_dir, pair.base+pair.quote);
+        *logger << "candles path: " << candles_path << std::endl;
 
         std::vector<trading::candle> candles;
+        validation_report validation;
         auto duration = measure_duration(to_function([&] {
-            return read_candles(candles_path, '|');
+            return read_candles(candles_path, '|', validation);
         }), candles);
 
         auto from = boost::posix_time::from_time_t(candles.front().opened());
@@ -214,12 +257,20 @@ int main()
                 << "difference: " << std::chrono::nanoseconds((to-from).total_nanoseconds()) << std::endl
                 << "count: " << candles.size() << std::endl
                 << "duration: " << duration << std::endl;
+        *logger << "candles validated:" << std::endl
+                << "invalid: " << validation.invalid_count << std::endl
+                << "duplicate: " << validation.duplicate_count << std::endl
+                << "out of order: " << validation.unordered_count << std::endl
+                << "dropped: " << validation.dropped_count << std::endl
+                << "gaps: " << validation.gaps.size() << " distinct lengths" << std::endl;
 
         json settings;
+        settings.emplace(json{"seed", seed});
         settings.emplace(json{"candles", {
                 {"from", candles.front().opened()},
                 {"to", candles.back().opened()},
                 {"count", candles.size()},
+                {"dropped count", validation.dropped_count},
                 {"currency pair", json{
                         {"base",  pair.base},
                         {"quote", pair.quote}
@@ -261,70 +312,168 @@ int main()
 
         // create simulator
         std::size_t resampling_period{std::chrono::minutes(45).count()};
+        std::time_t resampling_offset{0};
+        std::time_t candle_period{std::chrono::seconds(std::chrono::minutes(1)).count()};
+        std::time_t indic_period{std::chrono::seconds(std::chrono::minutes(resampling_period)).count()};
         auto averager = candle::ohlc4{};
-        trading::simulator simulator{candles, static_cast<std::size_t>(resampling_period), averager, 5'000};
-
+        trading::candle_pyramid pyramid{std::move(candles), std::size_t{256} << 20, candle_period, resampling_offset};
+        auto indic_frame = pyramid(indic_period);
+        trading::simulator simulator{pyramid.base(), *indic_frame, pyramid.candle_period(), averager, min_equity};
+
+        // evaluate every 5th phase of the resampling
+        std::time_t phase_step{std::chrono::seconds(std::chrono::minutes(5)).count()};
+        std::vector<std::time_t> phase_offsets;
+        for (std::time_t offset{0}; offset<indic_period; offset += phase_step)
+            phase_offsets.emplace_back(resampling_offset+offset);
+        trading::phase_simulator phase_simulator{pyramid.base(), indic_period, candle_period, phase_offsets, averager,
+                                                 min_equity};
+
+        // the evaluations skip the runs of equal prices, the simulator of the charts keeps every tick
+        phase_simulator.compact();
+        *logger << "compression ratio of " << pair.base << "/" << pair.quote << ": "
+                << phase_simulator.compression_ratio() << std::endl;
+
+        settings.emplace(json{"market", {
+                {"fee", market_fee},
+                {"initial balance", init_balance},
+                {"minimum equity", min_equity}
+        }});
         settings.emplace(json{"resampling", {
                 {"period[min]", resampling_period},
+                {"offset[s]", resampling_offset},
+                {"candle period[s]", candle_period},
+                {"phase count", phase_offsets.size()},
+                {"phase step[s]", phase_step},
+                {"phase offsets[s]", phase_offsets},
+                {"compression ratio", phase_simulator.compression_ratio()},
                 {"averaging method", decltype(averager)::name}
         }});
 
         // create result
         enumerative_result<state_t, maximization> result{10, maximization()};
+        // the state keeps the least profitable phase, so every phase has to be profitable
         auto constraints = [](const state_t& curr) { return curr.stats.net_profit()>0.0; };
-        auto optim_criterion = prom_criterion{};
-        settings.emplace(json{"optimization criterion", decltype(optim_criterion)::name()});
+        auto optim_criterion = phase_criterion<prom_criterion>{};
+        settings.emplace(json{"optimization criterion", {
+                {"name", decltype(optim_criterion)::name()},
+                {"worst weight", optim_criterion.worst_weight},
+                {"deviation weight", optim_criterion.deviation_weight}
+        }});
+
+        // create objective, the statistics of the least profitable phase are kept in the state
+        // trade events are cached per phase, so the order sizes variants are not re-simulated
+        // events are found through the crossing bitmaps of all unique levels
+        auto unique_levels = systematic::levels_generator<n_levels>{levels_unique_count, levels_lower_bound}
+                .unique_levels();
+        // by default the bitmaps of every indicator of the search space fit, up to 1 GiB for all phases
+        auto bitmaps_set_memory = bazooka::crossing_bitmaps<n_levels>::set_memory(phase_simulator.prices().size(),
+                unique_levels.size());
+        std::size_t indicator_count{tags.size()*
+                                    systematic::int_range_generator{period_from, period_to, period_step}.value_count()};
+        std::size_t bitmaps_budget = bitmaps_budget_mib ? (bitmaps_budget_mib << 20)/phase_simulator.phase_count()
+                : std::max(bitmaps_set_memory, std::min(indicator_count*bitmaps_set_memory,
+                        (std::size_t{1} << 30)/phase_simulator.phase_count()));
+        std::deque<bazooka::crossing_bitmaps<n_levels>> crossing_bitmaps;
+        std::deque<bazooka::event_cache<n_levels>> event_caches;
+
+        for (std::size_t p{0}; p<phase_simulator.phase_count(); p++) {
+            crossing_bitmaps.emplace_back(phase_simulator, p, unique_levels, bitmaps_budget);
+            event_caches.emplace_back(phase_simulator, p);
+            event_caches.back().use(crossing_bitmaps.back());
+        }
 
-        // create objective
         auto objective = [&](const config_t& curr) {
-            bazooka::statistics<n_levels>::collector collector{};
-            simulator(create_trader(curr), collector);
-            auto stats = collector.get();
-            return state_t{{curr, optim_criterion(stats)}, stats};
+            auto trader = create_trader(curr);
+            auto strategy = trader.strategy();
+            auto manager = trader.manager();
+
+            std::vector<bazooka::statistics<n_levels>> phase_stats;
+            phase_stats.reserve(event_caches.size());
+            for (auto& cache: event_caches) {
+                bazooka::statistics<n_levels>::collector collector;
+                cache(curr, strategy, manager, collector);
+                phase_stats.emplace_back(collector.get());
+            }
+            auto worst = std::min_element(phase_stats.begin(), phase_stats.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.net_profit()<rhs.net_profit();
+            });
+            return state_t{{curr, optim_criterion(phase_stats)}, *worst};
         };
 
+        // configurations reaching the same depth with the same effective sizes are evaluated only once,
+        // while their behavior is kept in the bounded memory
+        auto behavior_key = [&](const config_t& curr) {
+            auto strategy = create_trader(curr).strategy();
+            std::size_t depth{0};
+            for (auto& cache: event_caches)
+                depth = std::max(depth, cache.events(curr, strategy)->depth);
+            return bazooka::behavior<n_levels>{curr, depth};
+        };
+        trading::equivalent_objective<state_t, decltype(objective), decltype(behavior_key)>
+                equivalent{objective, behavior_key, std::size_t{1} << 18, 64};
+        trading::equivalence_reporter equivalence_reporter{equivalent, logger};
+
+        // duplicate configurations of the metaheuristics are answered without computing the behavior
+        trading::evaluation_cache<state_t, decltype(equivalent)&> cache{equivalent, std::size_t{1} << 16, 64};
+        trading::evaluation_cache_reporter cache_reporter{cache, logger};
+
         std::cout << "optimizer: " <<  optimizer_name << std::endl;
         if (optim_tag==optimizer_tag::brute_force) {
-            brute_force::parallel::optimizer<state_t> optimizer{};
-
-            // create generators
-            systematic::levels_generator<n_levels> sys_levels{levels_unique_count, levels_lower_bound};
-            systematic::sizes_generator<n_levels> sys_sizes{sizes_unique_count};
-            systematic::int_range_generator sys_periods{period_from, period_to, period_step};
+            // the grid is split into shards, that can be evaluated by several processes and resumed,
+            // the settings except the seed identify the run
+            auto run_settings = settings;
+            run_settings.erase("seed");
+            brute_force::sharded::optimizer<state_t> optimizer{experiment_dir/"shards", std::size_t{1} << 14,
+                                                               worker_index, worker_count, run_settings.dump()};
+            settings.emplace(json{"optimizer", {
+                    {"shard size", optimizer.shard_size()},
+                    {"worker count", optimizer.worker_count()}
+            }});
 
             // create search space
-            auto search_space = [&]() -> cppcoro::generator<config_t> {
-                for (std::size_t period: sys_periods())
-                    for (const auto& tag: tags)
-                        for (const auto& levels: sys_levels())
-                            for (const auto& open_sizes: sys_sizes())
-                                co_yield config_t{tag, period, levels, open_sizes};
+            bazooka::search_space<n_levels> search_space{
+                    systematic::int_range_generator{period_from, period_to, period_step},
+                    {tags.begin(), tags.end()},
+                    systematic::levels_generator<n_levels>{levels_unique_count, levels_lower_bound},
+                    systematic::sizes_generator<n_levels>{sizes_unique_count}
             };
-
-            std::size_t period_count, tag_count, levels_count, sizes_count;
-            period_count = tag_count = levels_count = sizes_count = 0;
-            for (const auto& p: sys_periods()) period_count++;
-            for (const auto& t: tags) tag_count++;
-            for (const auto& l: sys_levels()) levels_count++;
-            for (const auto& s: sys_sizes()) sizes_count++;
-            *logger << "periods count: " << period_count << std::endl
-                    << "tag count: " << tag_count << std::endl
-                    << "levels count: " << levels_count << std::endl
-                    << "sizes count: " << sizes_count << std::endl
-                    << "total count: " << period_count*tag_count*levels_count*sizes_count << std::endl;
+            *logger << "periods count: " << search_space.periods().value_count() << std::endl
+                    << "tag count: " << search_space.tags().size() << std::endl
+                    << "levels count: " << search_space.levels().value_count() << std::endl
+                    << "sizes count: " << search_space.sizes().value_count() << std::endl
+                    << "total count: " << search_space.size() << std::endl;
 
             // optimize
             *logger << "began: " << boost::posix_time::second_clock::local_time() << std::endl;
+            std::size_t evaluated_count;
             duration = measure_duration(to_function([&] {
-                optimizer(result, constraints, objective, search_space);
+                evaluated_count = optimizer(result, constraints, equivalent, search_space);
             }));
             *logger << "ended: " << boost::posix_time::second_clock::local_time() << std::endl
-                    << "duration: " << duration << std::endl;
+                    << "duration: " << duration << std::endl
+                    << "shards evaluated: " << evaluated_count << " of "
+                    << optimizer.shard_count(search_space.size()) << std::endl;
+
+            // only the worker claiming the merge saves the results, the others leave the directory to it
+            if (!optimizer.completed_all(search_space.size())) {
+                *logger << "skipping the merge: shards of the other workers are not completed, "
+                           "the last worker to complete them merges them" << std::endl;
+                continue;
+            }
+            if (!optimizer.claim_merge()) {
+                *logger << "skipping the merge: it is claimed by worker " << optimizer.merge_owner().value_or(0)
+                        << std::endl;
+                continue;
+            }
+            *logger << "merging the shards" << std::endl;
+            optimizer.merge(result, constraints, equivalent, search_space.size());
         }
         else {
-            random::levels_generator<n_levels> rand_levels{levels_unique_count, levels_lower_bound};
-            random::sizes_generator<n_levels> rand_sizes{sizes_unique_count};
-            random::int_range_generator rand_period{period_from, period_to, period_step, 10};
+            random::levels_generator<n_levels> rand_levels{levels_unique_count, levels_lower_bound, 1,
+                                                           stream(stream_tag::levels)};
+            random::sizes_generator<n_levels> rand_sizes{sizes_unique_count, 2, stream(stream_tag::sizes)};
+            random::int_range_generator rand_period{period_from, period_to, period_step, 10,
+                                                    stream(stream_tag::period)};
 
             settings["search space"]["levels"]["change count"] = rand_levels.change_count();
             settings["search space"]["open order sizes"]["change count"] = rand_sizes.change_count();
@@ -332,18 +481,22 @@ int main()
 
             if (optim_tag==optimizer_tag::simulated_annealing) {
                 double start_temp{94}, min_temp{12};
-                trading::simulated_annealing::optimizer<state_t> optimizer{start_temp, min_temp};
+                trading::simulated_annealing::optimizer<state_t> optimizer{start_temp, min_temp,
+                                                                           std::max(1U, std::thread::hardware_concurrency()),
+                                                                           stream(stream_tag::optimizer)};
                 auto cooler = trading::simulated_annealing::basic_cooler{};
                 auto equilibrium = trading::simulated_annealing::temperature_based_equilibrium{{75, 100}};
 
                 settings.emplace(json{"optimizer", {
                         {"start temperature", optimizer.start_temperature()},
                         {"minimum temperature", optimizer.minimum_temperature()},
+                        {"speculation", optimizer.speculation()},
                         {"equilibrium", equilibrium},
                         {"cooler", cooler}
                 }});
 
-                bazooka::neighbor<n_levels> neighbor{rand_levels, rand_sizes, rand_period};
+                bazooka::neighbor<n_levels> neighbor{rand_levels, rand_sizes, rand_period,
+                                                     stream(stream_tag::neighbor)};
                 bazooka::configuration<n_levels> init{tags[0], static_cast<std::size_t>(rand_period()), rand_levels(),
                                                       rand_sizes()};
                 auto appraise = [](const state_t& current, const state_t& candidate) -> double {
@@ -352,17 +505,19 @@ int main()
 
                 simulated_annealing::progress_collector progress_observer;
                 simulated_annealing::progress_reporter reporter{logger};
-                config_t next;
 
                 // optimize
                 *logger << "began: " << boost::posix_time::second_clock::local_time() << std::endl;
                 duration = measure_duration([&]() {
-                    optimizer(init, result, constraints, objective, cooler,
-                            [&](const config_t& genes) {
+                    // the neighbor is captured by value, so the speculative draws can be taken from its copy
+                    optimizer(init, result, constraints, cache, cooler,
+                            [neighbor](const config_t& genes) mutable {
+                                config_t next;
                                 std::tie(next, std::ignore) = neighbor(genes);
                                 return next;
                             },
-                            appraise, equilibrium, progress_observer, reporter);
+                            appraise, equilibrium, progress_observer, reporter, cache_reporter,
+                            equivalence_reporter);
                 });
                 *logger << "ended: " << boost::posix_time::second_clock::local_time() << std::endl
                         << "duration: " << duration << std::endl;
@@ -373,16 +528,72 @@ int main()
                 for (const auto& progress: progress_observer.get())
                     writer.write_row(progress.temperature, progress.curr_state_value, progress.best_state_value);
             }
+            else if (optim_tag==optimizer_tag::parallel_tempering) {
+                // geometric ladder between the temperatures of simulated annealing
+                double min_temp{12}, max_temp{94};
+                std::size_t chain_count{std::max(2U, std::thread::hardware_concurrency())}, sweep{16};
+                std::vector<double> temps;
+                for (std::size_t c{0}; c<chain_count; c++)
+                    temps.emplace_back(min_temp*std::pow(max_temp/min_temp, static_cast<double>(c)/(chain_count-1)));
+                trading::simulated_annealing::parallel_tempering<state_t> optimizer{temps, sweep,
+                                                                                    stream(stream_tag::optimizer)};
+                auto termination = iteration_based_termination{64};
+
+                settings.emplace(json{"optimizer", {
+                        {"temperatures", temps},
+                        {"sweep", sweep},
+                        {"termination", termination}
+                }});
+
+                // each chain draws its neighbors from its own generators, so a seeded run is repeated
+                auto make_neighbor = [=](random::engine gen) {
+                    bazooka::neighbor<n_levels> neighbor{
+                            random::levels_generator<n_levels>{levels_unique_count, levels_lower_bound, 1, gen.split(0)},
+                            random::sizes_generator<n_levels>{sizes_unique_count, 2, gen.split(1)},
+                            random::int_range_generator{period_from, period_to, period_step, 10, gen.split(2)},
+                            gen.split(3)};
+                    return [neighbor](const config_t& genes) mutable {
+                        config_t next;
+                        std::tie(next, std::ignore) = neighbor(genes);
+                        return next;
+                    };
+                };
+                bazooka::configuration<n_levels> init{tags[0], static_cast<std::size_t>(rand_period()), rand_levels(),
+                                                      rand_sizes()};
+                auto appraise = [](const state_t& current, const state_t& candidate) -> double {
+                    return current.value-candidate.value;
+                };
+
+                simulated_annealing::progress_collector progress_observer;
+                simulated_annealing::progress_reporter reporter{logger};
+
+                // optimize
+                *logger << "began: " << boost::posix_time::second_clock::local_time() << std::endl;
+                duration = measure_duration([&]() {
+                    optimizer(init, result, constraints, cache, make_neighbor, appraise, termination, progress_observer, reporter, cache_reporter,
+                            equivalence_reporter);
+                });
+                *logger << "ended: " << boost::posix_time::second_clock::local_time() << std::endl
+                        << "duration: " << duration << std::endl;
+
+                // save progress, a row per chain from the coldest
+                io::csv::writer<3> writer(experiment_dir/"progress.csv");
+                writer.write_header({"temperature", "curr value", "best value"});
+                for (const auto& progress: progress_observer.get())
+                    writer.write_row(progress.temperature, progress.curr_state_value, progress.best_state_value);
+            }
             else if (optim_tag==optimizer_tag::genetic_algorithm) {
                 constexpr std::size_t n_children{2};
                 using crossover_type = bazooka::configuration_crossover<n_levels, n_children>;
                 std::size_t init_genes_count = 128;
                 auto sizer = basic_sizer{{110, 100}};
-                auto selection = genetic_algorithm::roulette_selection{};
-                auto matchmaker = genetic_algorithm::random_matchmaker<crossover_type::n_parents>{};
+                auto selection = genetic_algorithm::roulette_selection{stream(stream_tag::selection)};
+                auto matchmaker = genetic_algorithm::random_matchmaker<crossover_type::n_parents>{
+                        stream(stream_tag::matchmaker)};
                 auto replacement = genetic_algorithm::elitism_replacement{{15, 100}};
                 auto termination = iteration_based_termination{10};
-                auto rand_genes = random::configuration_generator<n_levels>{rand_sizes, rand_levels, rand_period};
+                auto rand_genes = random::configuration_generator<n_levels>{rand_sizes, rand_levels, rand_period,
+                                                                            stream(stream_tag::genes)};
 
                 settings.emplace(json{"initial genes count", init_genes_count});
                 settings.emplace(json{"optimizer", {
@@ -404,21 +615,23 @@ int main()
 
                 genetic_algorithm::progress_collector progress_collector;
                 genetic_algorithm::progress_reporter reporter{logger};
-                genetic_algorithm::progress_observers observers{progress_collector, reporter};
+                genetic_algorithm::progress_observers observers{progress_collector, reporter, cache_reporter,
+                                                                equivalence_reporter};
 
-                auto neighbor = bazooka::neighbor<n_levels>{rand_levels, rand_sizes, rand_period};
+                auto neighbor = bazooka::neighbor<n_levels>{rand_levels, rand_sizes, rand_period,
+                                                            stream(stream_tag::neighbor)};
                 auto mutation = [&](const config_t& genes) {
                     config_t next;
                     std::tie(next, std::ignore) = neighbor(genes);
                     return next;
                 };
 
-                genetic_algorithm::optimizer<state_t> optimizer;
+                genetic_algorithm::optimizer<state_t> optimizer{std::max(1U, std::thread::hardware_concurrency())};
 
                 *logger << "began: " << boost::posix_time::second_clock::local_time() << std::endl;
                 duration = measure_duration([&]() {
-                    optimizer(init_genes, result, constraints, objective, sizer, selection, matchmaker,
-                            crossover_type{},
+                    optimizer(init_genes, result, constraints, cache, sizer, selection, matchmaker,
+                            crossover_type{stream(stream_tag::crossover)},
                             mutation, replacement, termination, observers);
                 });
                 *logger << "ended: " << boost::posix_time::second_clock::local_time() << std::endl
@@ -436,7 +649,8 @@ int main()
 
                 auto termination = iteration_based_termination{128};
                 std::size_t neighborhood{256}, tenure{32};
-                bazooka::neighbor<n_levels> neighbor{rand_levels, rand_sizes, rand_period};
+                bazooka::neighbor<n_levels> neighbor{rand_levels, rand_sizes, rand_period,
+                                                     stream(stream_tag::neighbor)};
                 bazooka::configuration<n_levels> init{tags[0], static_cast<std::size_t>(rand_period()),
                                                       rand_levels(), rand_sizes()};
 
@@ -456,15 +670,16 @@ int main()
 
                 tabu_search::progress_collector collector;
                 tabu_search::progress_reporter reporter{logger};
-                tabu_search::optimizer<state_t, move_t, memory_t> optimizer{memory};
+                tabu_search::optimizer<state_t, move_t, memory_t> optimizer{memory,
+                                                                            std::max(1U, std::thread::hardware_concurrency())};
                 auto aspiration = [&](const auto& candidate, const auto& optimizer) -> bool {
                     return result.compare(candidate, optimizer.best_state());
                 };
 
                 *logger << "began: " << boost::posix_time::second_clock::local_time() << std::endl;
                 duration = measure_duration([&]() {
-                    optimizer(init, result, constraints, objective, neighbor, neighborhood_sizer, termination,
-                            aspiration, collector, reporter);
+                    optimizer(init, result, constraints, cache, neighbor, neighborhood_sizer, termination,
+                            aspiration, collector, reporter, cache_reporter, equivalence_reporter);
                 });
                 *logger << "ended: " << boost::posix_time::second_clock::local_time() << std::endl
                         << "duration: " << duration << std::endl;
@@ -477,25 +692,86 @@ int main()
             }
         }
 
+        *logger << "evaluations avoided: " << equivalent.avoided_count() << " of "
+                << equivalent.avoided_count()+equivalent.evaluated_count() << std::endl;
+        settings.emplace(json{"equivalence", {
+                {"evaluated count", equivalent.evaluated_count()},
+                {"avoided count", equivalent.avoided_count()},
+                {"capacity", equivalent.capacity()},
+                {"eviction count", equivalent.eviction_count()},
+                {"memory[B]", equivalent.memory()}
+        }});
+
+        *logger << "cache hit ratio: " << cache.hit_ratio() << ", memory: " << cache.memory() << " B" << std::endl;
+        settings.emplace(json{"evaluation cache", {
+                {"capacity", cache.capacity()},
+                {"shard count", cache.shard_count()},
+                {"hit count", cache.hit_count()},
+                {"miss count", cache.miss_count()},
+                {"eviction count", cache.eviction_count()},
+                {"memory[B]", cache.memory()}
+        }});
+
+        std::size_t bitmaps_memory{0}, bitmaps_hit_count{0}, bitmaps_miss_count{0}, bitmaps_eviction_count{0};
+        for (const auto& bitmaps: crossing_bitmaps) {
+            bitmaps_memory += bitmaps.memory();
+            bitmaps_hit_count += bitmaps.hit_count();
+            bitmaps_miss_count += bitmaps.miss_count();
+            bitmaps_eviction_count += bitmaps.eviction_count();
+        }
+        *logger << "crossing bitmaps memory: " << bitmaps_memory << " B, hits: " << bitmaps_hit_count
+                << ", misses: " << bitmaps_miss_count << ", evictions: " << bitmaps_eviction_count << std::endl;
+        settings.emplace(json{"crossing bitmaps", {
+                {"memory[B]", bitmaps_memory},
+                {"budget per phase[B]", bitmaps_budget},
+                {"memory per indicator[B]", bitmaps_set_memory},
+                {"indicator count", indicator_count},
+                {"hit count", bitmaps_hit_count},
+                {"miss count", bitmaps_miss_count},
+                {"eviction count", bitmaps_eviction_count}
+        }});
+
         // save settings
         std::ofstream{experiment_dir/"settings.json"} << std::setw(4) << settings << std::endl;
 
-        // save top states
+        // the events of the top states are recorded in parallel segments,
+        // the windows and the charts then only replay them tick by tick
+        bazooka::segmented_recorder<n_levels> top_recorder{simulator,
+                                                           std::max(1U, std::thread::hardware_concurrency())};
+        bazooka::event_cache<n_levels> top_events{simulator};
+        top_events.use(top_recorder);
+
+        auto replay_ticks = [&](const config_t& curr, auto& ... observers) {
+            auto trader = create_trader(curr);
+            top_events.replay_ticks(curr, trader.strategy(), trader.manager(), observers...);
+        };
+
+        // save top states, with the statistics of each year collected in one replay
+        auto years = yearly_boundaries(simulator.prices().front().time, simulator.prices().back().time);
         json result_doc;
         auto best = result.get();
-        for (const auto& top: best)
+        for (const auto& top: best) {
+            bazooka::statistics<n_levels>::windowed_collector windows_collector{years};
+            replay_ticks(top.config, windows_collector);
+            auto windowed = windows_collector.get();
+            json windows_doc = windowed;
+            for (std::size_t w{0}; w<windowed.windows.size(); w++)
+                windows_doc["windows"][w]["criterion"] = optim_criterion.criterion(windowed.windows[w].stats);
+
             result_doc.emplace_back(json{
                     {"configuration",      top.config},
                     {"statistics",         top.stats},
-                    {"optimization value", top.value}
+                    {"optimization value", top.value},
+                    {"yearly",             windows_doc["windows"]}
             });
+        }
         std::ofstream{experiment_dir/"best-states.json"} << std::setw(4) << result_doc << std::endl;
 
         // save best state series
         auto top = result.get();
         if (top.size()) {
             chart_series<n_levels>::collector series_collector;
-            simulator(create_trader(top[0].config), series_collector);
+            replay_ticks(top[0].config, series_collector);
             std::filesystem::path best_dir{experiment_dir/"best-series"};
             std::filesystem::create_directory(best_dir);
             to_csv(series_collector.get(), best_dir);
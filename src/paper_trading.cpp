@@ -0,0 +1,96 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <csignal>
+#include <string>
+#include <thread>
+#include <variant>
+#include <filesystem>
+#include <trading.hpp>
+#include <trading/convert.hpp>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+using namespace trading;
+
+constexpr std::size_t n_levels{3};
+volatile std::sig_atomic_t interrupted{0};
+
+// usage: paper_trading <best-states.json> <csv:path | binary:path | socket:path> [state index] [decisions.csv]
+int main(int argc, char* argv[])
+{
+    if (argc<3) {
+        std::cerr << "usage: " << argv[0]
+                  << " <best-states.json> <csv:path | binary:path | socket:path> [state index] [decisions.csv]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // restore the configuration
+    json states = json::parse(std::ifstream{argv[1]});
+    std::size_t state_idx = (argc>3) ? std::stoul(argv[3]) : 0;
+    auto config = states.at(state_idx).at("configuration").get<bazooka::configuration<n_levels>>();
+
+    bazooka::indicator indic;
+    if (config.tag==bazooka::indicator_tag::ema) {
+        indic = ema{config.period};
+    }
+    else {
+        indic = sma{config.period};
+    }
+    bazooka::strategy strategy{indic, indic, config.levels};
+
+    // same market and resampling as the optimization, read from the settings saved next to the states
+    json settings = json::parse(std::ifstream{std::filesystem::path{argv[1]}.parent_path()/"settings.json"});
+    const auto& market_doc = settings.at("market");
+    auto fee = market_doc.at("fee").get<fraction_t>();
+    auto init_balance = market_doc.at("initial balance").get<amount_t>();
+    auto min_equity = market_doc.at("minimum equity").get<amount_t>();
+    trading::market market{wallet{init_balance}, fee, fee};
+    bazooka::manager manager{market, order_sizer{config.sizes}};
+    bazooka::trader trader{strategy, manager};
+
+    const auto& resampling_doc = settings.at("resampling");
+    auto candle_period = resampling_doc.at("candle period[s]").get<std::time_t>();
+    auto resampling_offset = resampling_doc.at("offset[s]").get<std::time_t>();
+    std::time_t resampling_period{std::chrono::seconds(
+            std::chrono::minutes(resampling_doc.at("period[min]").get<std::time_t>())).count()};
+    time_resampler resampler{resampling_period, candle_period, resampling_offset};
+
+    // open the feed
+    std::string spec{argv[2]};
+    auto sep = spec.find(':');
+    std::string kind{spec.substr(0, sep)};
+    std::filesystem::path path{(sep==std::string::npos) ? "" : spec.substr(sep+1)};
+    using feed_type = std::variant<paper::csv_feed, paper::binary_feed, paper::socket_feed>;
+    auto feed = [&]() -> feed_type {
+        if (kind=="csv") return feed_type{std::in_place_type<paper::csv_feed>, path, '|'};
+        if (kind=="binary") return feed_type{std::in_place_type<paper::binary_feed>, path};
+        if (kind=="socket") return feed_type{std::in_place_type<paper::socket_feed>, path};
+        throw std::invalid_argument("Unknown feed: "+kind);
+    }();
+
+    std::ofstream decisions_file;
+    if (argc>4) decisions_file.open(argv[4]);
+    paper::log_sink<paper::decision_record> sink{argc>4 ? decisions_file : std::cout};
+    paper::runner runner{trader, resampler, sink, min_equity};
+
+    // only the flag is set in the handler, the watcher polls it and stops the runner
+    std::stop_source stop;
+    std::signal(SIGINT, [](int) { interrupted = 1; });
+    std::jthread watcher{[&stop](std::stop_token token) {
+        while (!token.stop_requested() && !interrupted)
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        if (interrupted) stop.request_stop();
+    }};
+    std::visit([&](auto& concrete) { runner.run(concrete, stop.get_token()); }, feed);
+    watcher.request_stop();
+    watcher.join();
+    sink.close();
+
+    const auto& histogram = runner.histogram();
+    std::cerr << "candles: " << histogram.count() << ", dropped decisions: " << sink.dropped_count() << std::endl
+              << "latency p50: " << histogram.percentile(0.5).count() << " ns, p99: "
+              << histogram.percentile(0.99).count() << " ns, max: " << histogram.max().count() << " ns" << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_CPPCORO_FRAME_POOL_HPP
+#define BACKTESTING_TEST_CPPCORO_FRAME_POOL_HPP
+
+#include <memory>
+#include <thread>
+#include <optional>
+#include <boost/test/unit_test.hpp>
+#include <cppcoro/generator.hpp>
+#include <cppcoro/recursive_generator.hpp>
+#include <cppcoro/frame_pool.hpp>
+
+BOOST_AUTO_TEST_SUITE(frame_pool_test)
+    cppcoro::generator<int> count(int n)
+    {
+        for (int i{0}; i<n; i++)
+            co_yield i;
+    }
+
+    cppcoro::recursive_generator<int> nested(int depth)
+    {
+        co_yield depth;
+        if (depth) co_yield nested(depth-1);
+    }
+
+    BOOST_AUTO_TEST_CASE(reuse_test)
+    {
+        auto& pool = cppcoro::frame_pool::local();
+        auto sum = [] {
+            int sum{0};
+            for (int val: count(10)) sum += val;
+            for (int val: nested(5)) sum += val;
+            return sum;
+        };
+
+        BOOST_REQUIRE_EQUAL(sum(), 60);
+        std::size_t allocated_count = pool.allocated_count();
+        for (int i{0}; i<100; i++)
+            BOOST_REQUIRE_EQUAL(sum(), 60);
+        BOOST_REQUIRE_EQUAL(pool.allocated_count(), allocated_count);
+    }
+
+    struct allocation_counts {
+        std::size_t allocated_count{0}, deallocated_count{0};
+    };
+
+    // copies share the counts, the frame keeps its own copy
+    struct counting_allocator {
+        allocation_counts* counts;
+
+        void* allocate(std::size_t size)
+        {
+            counts->allocated_count++;
+            return ::operator new(size);
+        }
+
+        void deallocate(void* frame, std::size_t)
+        {
+            counts->deallocated_count++;
+            ::operator delete(frame);
+        }
+    };
+
+    cppcoro::generator<int> count(std::allocator_arg_t, counting_allocator, int n)
+    {
+        for (int i{0}; i<n; i++)
+            co_yield i;
+    }
+
+    BOOST_AUTO_TEST_CASE(allocator_test)
+    {
+        allocation_counts counts;
+        {
+            // the argument is gone before the frame is freed
+            auto gen = count(std::allocator_arg, counting_allocator{&counts}, 10);
+            int sum{0};
+            for (int val: gen) sum += val;
+            BOOST_REQUIRE_EQUAL(sum, 45);
+            BOOST_REQUIRE_EQUAL(counts.allocated_count, 1);
+        }
+        BOOST_REQUIRE_EQUAL(counts.deallocated_count, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(other_thread_test)
+    {
+        // the frame is taken from the pool of the worker, that exits before it is freed
+        std::optional<cppcoro::generator<int>> gen;
+        std::thread{[&] { gen.emplace(count(10)); }}.join();
+
+        int sum{0};
+        for (int val: *gen) sum += val;
+        BOOST_REQUIRE_EQUAL(sum, 45);
+        gen.reset();
+    }
+
+    // destroyed after the pool of the thread, when it is constructed first
+    struct late_holder {
+        std::optional<cppcoro::generator<int>> gen;
+        bool* freed_after_pool;
+
+        ~late_holder()
+        {
+            *freed_after_pool = !cppcoro::frame_pool::local_alive();
+            gen.reset();
+        }
+    };
+
+    BOOST_AUTO_TEST_CASE(thread_exit_test)
+    {
+        bool freed_after_pool{false};
+        std::thread{[&] {
+            thread_local late_holder holder;
+            holder.freed_after_pool = &freed_after_pool;
+            holder.gen.emplace(count(10));
+            BOOST_REQUIRE(cppcoro::frame_pool::local_alive());
+        }}.join();
+        BOOST_REQUIRE(freed_after_pool);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_CPPCORO_FRAME_POOL_HPP
@@ -3,39 +3,65 @@
 //
 
 #define BOOST_TEST_MAIN
+#include "cppcoro/frame_pool.hpp"
+#include "trading/bazooka/behavior.hpp"
+#include "trading/bazooka/search_space.hpp"
+#include "trading/bazooka/crossing_bitmaps.hpp"
 #include "trading/bazooka/crossover.hpp"
+#include "trading/bazooka/event_cache.hpp"
 #include "trading/bazooka/indicator.hpp"
+#include "trading/bazooka/live_engine.hpp"
 #include "trading/bazooka/manager.hpp"
+#include "trading/bazooka/segmented_recorder.hpp"
 #include "trading/bazooka/statistics.hpp"
 #include "trading/bazooka/strategy.hpp"
 #include "trading/bazooka/trader.hpp"
 #include "trading/brute_force/parallel/optimizer.hpp"
+#include "trading/brute_force/sharded/optimizer.hpp"
+#include "trading/genetic_algorithm/arena.hpp"
 #include "trading/genetic_algorithm/matchmaker.hpp"
 #include "trading/genetic_algorithm/optimizer.hpp"
 #include "trading/genetic_algorithm/replacement.hpp"
 #include "trading/genetic_algorithm/selection.hpp"
+#include "trading/paper/feed.hpp"
+#include "trading/paper/latency_histogram.hpp"
+#include "trading/paper/log_sink.hpp"
+#include "trading/paper/runner.hpp"
+#include "trading/random/engine.hpp"
 #include "trading/random/generators.hpp"
 #include "trading/simulated_annealing/equilibrium.hpp"
 #include "trading/simulated_annealing/optimizer.hpp"
+#include "trading/simulated_annealing/parallel_tempering.hpp"
 #include "trading/simulated_annealing/progress_collector.hpp"
 #include "trading/systematic/generators.hpp"
 #include "trading/tabu_search/memory.hpp"
 #include "trading/tabu_search/optimizer.hpp"
 #include "trading/candle.hpp"
+#include "trading/candle_validator.hpp"
+#include "trading/calendar.hpp"
+#include "trading/clock_cache.hpp"
 #include "trading/criterion.hpp"
+#include "trading/equivalence.hpp"
+#include "trading/evaluation_cache.hpp"
 #include "trading/wallet.hpp"
 #include "trading/bazooka/trader.hpp"
 #include "trading/position.hpp"
 #include "trading/order_sizer.hpp"
 #include "trading/motion_tracker.hpp"
 #include "trading/resampler.hpp"
+#include "trading/time_resampler.hpp"
+#include "trading/tick_aggregator.hpp"
+#include "trading/candle_pyramid.hpp"
 #include "trading/ma.hpp"
 #include "trading/market.hpp"
 #include "trading/ema.hpp"
 #include "trading/sma.hpp"
+#include "trading/io/compressed_ifstream.hpp"
 #include "trading/io/csv/reader.hpp"
+#include "trading/io/csv/tick_reader.hpp"
 #include "trading/io/csv/writer.hpp"
 #include "trading/fixtures.hpp"
 #include "trading/result.hpp"
 #include "trading/simulator.hpp"
+#include "trading/phase_simulator.hpp"
 #include "trading/statistics.hpp"
\ No newline at end of file
@@ -0,0 +1,125 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_BAZOOKA_BEHAVIOR_HPP
+#define BACKTESTING_TEST_BAZOOKA_BEHAVIOR_HPP
+
+#include <cmath>
+#include <vector>
+#include <unordered_set>
+#include <boost/test/unit_test.hpp>
+#include <trading/bazooka/behavior.hpp>
+#include <trading/bazooka/event_cache.hpp>
+#include <trading/bazooka/state.hpp>
+#include <trading/bazooka/trader.hpp>
+#include <trading/bazooka/manager.hpp>
+#include <trading/equivalence.hpp>
+#include <trading/evaluation_cache.hpp>
+#include <trading/simulator.hpp>
+#include <trading/sma.hpp>
+#include <trading/ema.hpp>
+
+BOOST_AUTO_TEST_SUITE(bazooka_behavior_test)
+    constexpr std::size_t n_levels{3};
+    using config_type = trading::bazooka::configuration<n_levels>;
+    using behavior_type = trading::bazooka::behavior<n_levels>;
+
+    BOOST_AUTO_TEST_CASE(unreached_sizes_test)
+    {
+        config_type lhs{trading::bazooka::indicator_tag::sma, 12, {{{19, 20}, {18, 20}, {16, 20}}},
+                        {{{1, 4}, {1, 4}, {2, 4}}}};
+        config_type rhs{lhs.tag, lhs.period, lhs.levels, {{{1, 4}, {2, 4}, {1, 4}}}};
+
+        BOOST_REQUIRE(behavior_type(lhs, 1)==behavior_type(rhs, 1));
+        BOOST_REQUIRE(std::hash<behavior_type>{}(behavior_type(lhs, 1))==
+                std::hash<behavior_type>{}(behavior_type(rhs, 1)));
+        BOOST_REQUIRE(!(behavior_type(lhs, 2)==behavior_type(rhs, 2)));
+    }
+
+    // oscillating prices, so the positions are opened at several levels and closed
+    std::vector<trading::candle> behavior_candles()
+    {
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<2'000; i++) {
+            auto close = static_cast<trading::price_t>(100.0+20.0*std::sin(i/37.0)+7.0*std::sin(i/5.0));
+            candles.emplace_back(trading::candle{i*60, close, close+1, close-1, close});
+        }
+        return candles;
+    }
+
+    auto create_trader(const config_type& config)
+    {
+        trading::bazooka::indicator indic;
+        if (config.tag==trading::bazooka::indicator_tag::ema)
+            indic = trading::ema{config.period};
+        else
+            indic = trading::sma{config.period};
+        trading::fraction_t fee{1, 100};
+        trading::market market{trading::wallet{10'000}, fee, fee};
+        return trading::bazooka::trader{trading::bazooka::strategy{indic, indic, config.levels},
+                                        trading::bazooka::manager{market, trading::order_sizer{config.sizes}}};
+    }
+
+    BOOST_AUTO_TEST_CASE(simulation_test)
+    {
+        using state_type = trading::bazooka::state<n_levels>;
+        trading::simulator simulator{behavior_candles(), 3, trading::candle::ohlc4{}, 0};
+        trading::bazooka::event_cache<n_levels> events{simulator};
+
+        auto simulate = [&](const config_type& config) {
+            trading::bazooka::statistics<n_levels>::collector collector;
+            simulator(create_trader(config), collector);
+            auto stats = collector.get();
+            return state_type{{config, static_cast<double>(stats.final_balance())}, stats};
+        };
+        auto key = [&](const config_type& config) {
+            return behavior_type{config, events.events(config, create_trader(config).strategy())->depth};
+        };
+        trading::equivalent_objective<state_type, decltype(simulate), decltype(key)> equivalent{simulate, key, 64, 4};
+        trading::evaluation_cache<state_type, decltype(equivalent)&> cache{equivalent, 64, 4};
+
+        // the first two sizes have the same cumulative sizes, the others differ only in the deeper levels
+        std::vector<std::array<trading::fraction_t, n_levels>> sizes{
+                {{{1, 3}, {1, 3}, {1, 3}}},
+                {{{2, 6}, {2, 6}, {2, 6}}},
+                {{{1, 6}, {2, 6}, {3, 6}}},
+                {{{1, 6}, {3, 6}, {2, 6}}},
+                {{{1, 6}, {1, 6}, {4, 6}}},
+        };
+        std::vector<config_type> configs;
+        std::unordered_set<behavior_type> behaviors;
+        for (auto tag: {trading::bazooka::indicator_tag::sma, trading::bazooka::indicator_tag::ema})
+            for (const auto& curr_sizes: sizes) {
+                configs.emplace_back(config_type{tag, 12, {{{19, 20}, {18, 20}, {16, 20}}}, curr_sizes});
+                behaviors.emplace(key(configs.back()));
+            }
+
+        // the equivalent configurations make the same trades as the simulation of their own
+        for (const auto& config: configs) {
+            auto actual = cache(config), expect = simulate(config);
+            BOOST_REQUIRE(actual.config==config);
+            BOOST_REQUIRE(expect.stats.total_open_orders()>0);
+            BOOST_REQUIRE_EQUAL(actual.stats.final_balance(), expect.stats.final_balance());
+            BOOST_REQUIRE_EQUAL(actual.stats.total_open_orders(), expect.stats.total_open_orders());
+            BOOST_REQUIRE_EQUAL(actual.stats.total_close_all_orders(), expect.stats.total_close_all_orders());
+            BOOST_REQUIRE_EQUAL(actual.stats.max_equity_drawdown<trading::percent>(),
+                    expect.stats.max_equity_drawdown<trading::percent>());
+            BOOST_REQUIRE(actual.stats.open_order_counts()==expect.stats.open_order_counts());
+        }
+        BOOST_REQUIRE(behaviors.size()<configs.size());
+        BOOST_REQUIRE_EQUAL(equivalent.evaluated_count(), behaviors.size());
+        BOOST_REQUIRE_EQUAL(equivalent.avoided_count(), configs.size()-behaviors.size());
+        BOOST_REQUIRE_EQUAL(cache.miss_count(), configs.size());
+        BOOST_REQUIRE_EQUAL(cache.hit_count(), 0);
+
+        // the repeated configurations are answered by the cache without the equivalence
+        for (const auto& config: configs)
+            BOOST_REQUIRE(cache(config).config==config);
+        BOOST_REQUIRE_EQUAL(cache.hit_count(), configs.size());
+        BOOST_REQUIRE_EQUAL(cache.miss_count(), configs.size());
+        BOOST_REQUIRE_EQUAL(equivalent.evaluated_count()+equivalent.avoided_count(), configs.size());
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_BAZOOKA_BEHAVIOR_HPP
@@ -0,0 +1,161 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_BAZOOKA_CROSSING_BITMAPS_HPP
+#define BACKTESTING_TEST_BAZOOKA_CROSSING_BITMAPS_HPP
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <trading/bazooka/crossing_bitmaps.hpp>
+#include <trading/bazooka/event_cache.hpp>
+#include <trading/systematic/generators.hpp>
+#include <trading/simulator.hpp>
+#include <trading/phase_simulator.hpp>
+#include <trading/sma.hpp>
+#include <trading/ema.hpp>
+
+BOOST_AUTO_TEST_SUITE(bazooka_crossing_bitmaps_test)
+    constexpr std::size_t n_levels{3};
+    using config_type = trading::bazooka::configuration<n_levels>;
+
+    trading::simulator bitmap_simulator()
+    {
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<1'500; i++) {
+            double price = 100.0+15.0*std::sin(i/29.0)+6.0*std::sin(i/4.0)+4.0*std::cos(i/91.0);
+            auto close = static_cast<trading::price_t>(price);
+            candles.emplace_back(trading::candle{i*60, close, close+1, close-1, close});
+        }
+        return trading::simulator{candles, 3, trading::candle::ohlc4{}, 0};
+    }
+
+    auto create_strategy(const config_type& config)
+    {
+        trading::bazooka::indicator indic;
+        if (config.tag==trading::bazooka::indicator_tag::ema)
+            indic = trading::ema{config.period};
+        else
+            indic = trading::sma{config.period};
+        return trading::bazooka::strategy{indic, indic, config.levels};
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        auto simulator = bitmap_simulator();
+        BOOST_REQUIRE_THROW(trading::bazooka::crossing_bitmaps<n_levels>(simulator, {}, 1'000'000),
+                std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(equivalence_test)
+    {
+        auto simulator = bitmap_simulator();
+        trading::systematic::levels_generator<n_levels> levels_gen{7, {17, 20}};
+        trading::bazooka::crossing_bitmaps<n_levels> bitmaps{simulator, levels_gen.unique_levels(), 1'000'000};
+        trading::bazooka::event_cache<n_levels> cache{simulator};
+        std::array<trading::fraction_t, n_levels> sizes{{{1, 3}, {1, 3}, {1, 3}}};
+        std::size_t event_count{0};
+
+        for (auto tag: {trading::bazooka::indicator_tag::sma, trading::bazooka::indicator_tag::ema})
+            for (std::size_t period: {3, 8})
+                for (const auto& levels: levels_gen()) {
+                    config_type config{tag, period, levels, sizes};
+                    auto expect = cache.events(config, create_strategy(config))->events;
+                    auto actual = bitmaps(config, create_strategy(config));
+                    BOOST_REQUIRE(actual==expect);
+                    event_count += actual.size();
+                }
+
+        BOOST_REQUIRE(event_count>0);
+        BOOST_REQUIRE(bitmaps.memory()<=bitmaps.memory_budget());
+    }
+
+    BOOST_AUTO_TEST_CASE(event_cache_test)
+    {
+        auto simulator = bitmap_simulator();
+        trading::systematic::levels_generator<n_levels> levels_gen{7, {17, 20}};
+        trading::bazooka::crossing_bitmaps<n_levels> bitmaps{simulator, levels_gen.unique_levels(), 1'000'000};
+        trading::bazooka::event_cache<n_levels> expect{simulator}, actual{simulator};
+        actual.use(bitmaps);
+
+        config_type config{trading::bazooka::indicator_tag::ema, 5, *levels_gen().begin(), {{{1, 2}, {1, 4}, {1, 4}}}};
+        auto expect_log = expect.events(config, create_strategy(config));
+        auto actual_log = actual.events(config, create_strategy(config));
+        BOOST_REQUIRE(actual_log->events==expect_log->events);
+        BOOST_REQUIRE(actual_log->extremes==expect_log->extremes);
+        BOOST_REQUIRE(actual_log->extreme_ends==expect_log->extreme_ends);
+    }
+
+    BOOST_AUTO_TEST_CASE(compact_test)
+    {
+        // prices rounded to whole numbers, so they repeat in runs
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<1'500; i++) {
+            auto close = static_cast<trading::price_t>(std::round(100.0+15.0*std::sin(i/29.0)+3.0*std::sin(i/7.0)));
+            candles.emplace_back(trading::candle{i*60, close, close+1, close-1, close});
+        }
+        auto offsets = trading::phase_simulator::all_offsets(180, 60);
+        trading::phase_simulator expect_simulator{candles, 180, 60, offsets, trading::candle::ohlc4{}, 0};
+        trading::phase_simulator actual_simulator{candles, 180, 60, offsets, trading::candle::ohlc4{}, 0};
+        actual_simulator.compact();
+        BOOST_REQUIRE(actual_simulator.compression_ratio()>1.0);
+
+        trading::systematic::levels_generator<n_levels> levels_gen{7, {17, 20}};
+        std::array<trading::fraction_t, n_levels> sizes{{{1, 3}, {1, 3}, {1, 3}}};
+        std::size_t event_count{0};
+
+        for (std::size_t p{0}; p<offsets.size(); p++) {
+            trading::bazooka::crossing_bitmaps<n_levels> bitmaps{actual_simulator, p, levels_gen.unique_levels(),
+                                                                 1'000'000};
+            trading::bazooka::event_cache<n_levels> expect{expect_simulator, p}, actual{actual_simulator, p};
+
+            for (auto tag: {trading::bazooka::indicator_tag::sma, trading::bazooka::indicator_tag::ema})
+                for (const auto& levels: levels_gen()) {
+                    config_type config{tag, 5, levels, sizes};
+                    auto expect_events = expect.events(config, create_strategy(config))->events;
+                    BOOST_REQUIRE(actual.events(config, create_strategy(config))->events==expect_events);
+                    BOOST_REQUIRE(bitmaps(config, create_strategy(config))==expect_events);
+                    event_count += expect_events.size();
+                }
+        }
+        BOOST_REQUIRE(event_count>0);
+    }
+
+    BOOST_AUTO_TEST_CASE(memory_budget_test)
+    {
+        auto simulator = bitmap_simulator();
+        trading::systematic::levels_generator<n_levels> levels_gen{7, {17, 20}};
+        auto unique_levels = levels_gen.unique_levels();
+        auto set_memory = trading::bazooka::crossing_bitmaps<n_levels>::set_memory(simulator.prices().size(),
+                unique_levels.size());
+        BOOST_REQUIRE_EQUAL(set_memory, (unique_levels.size()+1)*((simulator.prices().size()+63)/64)*8);
+
+        // a single set fits, so the indicators evict each other
+        trading::bazooka::crossing_bitmaps<n_levels> bitmaps{simulator, unique_levels, set_memory};
+        config_type sma_config{trading::bazooka::indicator_tag::sma, 3, *levels_gen().begin(), {}};
+        config_type ema_config{trading::bazooka::indicator_tag::ema, 3, *levels_gen().begin(), {}};
+        bitmaps(sma_config, create_strategy(sma_config));
+        bitmaps(sma_config, create_strategy(sma_config));
+        bitmaps(ema_config, create_strategy(ema_config));
+        bitmaps(sma_config, create_strategy(sma_config));
+        BOOST_REQUIRE_EQUAL(bitmaps.memory(), set_memory);
+        BOOST_REQUIRE_EQUAL(bitmaps.hit_count(), 1);
+        BOOST_REQUIRE_EQUAL(bitmaps.miss_count(), 3);
+        BOOST_REQUIRE_EQUAL(bitmaps.eviction_count(), 2);
+
+        trading::bazooka::crossing_bitmaps<n_levels> both{simulator, unique_levels, 2*set_memory};
+        for (const auto& config: {sma_config, ema_config, sma_config, ema_config})
+            both(config, create_strategy(config));
+        BOOST_REQUIRE_EQUAL(both.hit_count(), 2);
+        BOOST_REQUIRE_EQUAL(both.miss_count(), 2);
+        BOOST_REQUIRE_EQUAL(both.eviction_count(), 0);
+
+        trading::bazooka::crossing_bitmaps<n_levels> small{simulator, unique_levels, set_memory-1};
+        BOOST_REQUIRE_THROW(small(sma_config, create_strategy(sma_config)), std::runtime_error);
+
+        config_type unindexed{trading::bazooka::indicator_tag::sma, 3, {{{19, 20}, {18, 20}, {1, 20}}}, {}};
+        BOOST_REQUIRE_THROW(bitmaps(unindexed, create_strategy(unindexed)), std::invalid_argument);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_BAZOOKA_CROSSING_BITMAPS_HPP
@@ -0,0 +1,192 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_BAZOOKA_EVENT_CACHE_HPP
+#define BACKTESTING_TEST_BAZOOKA_EVENT_CACHE_HPP
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <trading/bazooka/event_cache.hpp>
+#include <trading/bazooka/statistics.hpp>
+#include <trading/bazooka/manager.hpp>
+#include <trading/bazooka/segmented_recorder.hpp>
+#include <trading/chart_series.hpp>
+#include <trading/simulator.hpp>
+#include <trading/sma.hpp>
+#include <trading/ema.hpp>
+
+BOOST_AUTO_TEST_SUITE(bazooka_event_cache_test)
+    constexpr std::size_t n_levels{3};
+    using config_type = trading::bazooka::configuration<n_levels>;
+    using statistics_type = trading::bazooka::statistics<n_levels>;
+
+    // oscillating and declining prices, so positions are opened, closed and run into the minimum equity
+    std::vector<trading::candle> cache_candles(double decline)
+    {
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<2'000; i++) {
+            double price = 100.0+20.0*std::sin(i/37.0)+7.0*std::sin(i/5.0)-decline*i;
+            auto close = static_cast<trading::price_t>(price);
+            candles.emplace_back(trading::candle{i*60, close, close+1, close-1, close});
+        }
+        return candles;
+    }
+
+    auto create_strategy(const config_type& config)
+    {
+        trading::bazooka::indicator indic;
+        if (config.tag==trading::bazooka::indicator_tag::ema)
+            indic = trading::ema{config.period};
+        else
+            indic = trading::sma{config.period};
+        return trading::bazooka::strategy{indic, indic, config.levels};
+    }
+
+    auto create_manager(const config_type& config)
+    {
+        trading::fraction_t fee{1, 100};
+        trading::market market{trading::wallet{10'000}, fee, fee};
+        return trading::bazooka::manager{market, trading::order_sizer{config.sizes}};
+    }
+
+    void require_equal(const statistics_type& actual, const statistics_type& expect)
+    {
+        BOOST_REQUIRE_EQUAL(actual.final_balance(), expect.final_balance());
+        BOOST_REQUIRE_EQUAL(actual.total_open_orders(), expect.total_open_orders());
+        BOOST_REQUIRE_EQUAL(actual.total_close_all_orders(), expect.total_close_all_orders());
+        BOOST_REQUIRE_EQUAL(actual.min_equity(), expect.min_equity());
+        BOOST_REQUIRE_EQUAL(actual.max_equity(), expect.max_equity());
+        BOOST_REQUIRE_EQUAL(actual.max_equity_drawdown<trading::amount>(),
+                expect.max_equity_drawdown<trading::amount>());
+        BOOST_REQUIRE_EQUAL(actual.max_equity_drawdown<trading::percent>(),
+                expect.max_equity_drawdown<trading::percent>());
+        BOOST_REQUIRE_EQUAL(actual.max_equity_run_up<trading::amount>(),
+                expect.max_equity_run_up<trading::amount>());
+        BOOST_REQUIRE_EQUAL(actual.max_equity_run_up<trading::percent>(),
+                expect.max_equity_run_up<trading::percent>());
+        BOOST_REQUIRE_EQUAL(actual.min_close_balance(), expect.min_close_balance());
+        BOOST_REQUIRE_EQUAL(actual.max_close_balance(), expect.max_close_balance());
+        BOOST_REQUIRE_EQUAL(actual.gross_profit(), expect.gross_profit());
+        BOOST_REQUIRE_EQUAL(actual.gross_loss(), expect.gross_loss());
+        BOOST_REQUIRE_EQUAL(actual.win_count(), expect.win_count());
+        BOOST_REQUIRE_EQUAL(actual.loss_count(), expect.loss_count());
+        BOOST_REQUIRE(actual.open_order_counts()==expect.open_order_counts());
+    }
+
+    struct tick_counter {
+        std::size_t count{0};
+
+        template<class Trader>
+        void started(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void decided(const Trader&, trading::action, const trading::price_point&)
+        {
+            count++;
+        }
+
+        template<class Trader>
+        void position_active(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void indicators_updated(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void finished(const Trader&, const trading::price_point&) { }
+    };
+
+    // returns the number of variants stopped by the minimum equity
+    std::size_t require_equivalent(trading::simulator& simulator)
+    {
+        std::size_t stopped_count{0};
+        trading::bazooka::event_cache<n_levels> cache{simulator};
+        std::array<std::array<trading::fraction_t, n_levels>, 4> sizes{{
+                {{{1, 3}, {1, 3}, {1, 3}}},
+                {{{1, 6}, {2, 6}, {3, 6}}},
+                {{{4, 6}, {1, 6}, {1, 6}}},
+                {{{1, 6}, {1, 6}, {4, 6}}},
+        }};
+
+        for (auto tag: {trading::bazooka::indicator_tag::sma, trading::bazooka::indicator_tag::ema}) {
+            for (const auto& curr_sizes: sizes) {
+                config_type config{tag, 12, {{{19, 20}, {18, 20}, {16, 20}}}, curr_sizes};
+                auto strategy = create_strategy(config);
+                auto manager = create_manager(config);
+
+                statistics_type::collector expect;
+                tick_counter counter;
+                simulator(trading::bazooka::trader{strategy, manager}, expect, counter);
+                stopped_count += counter.count<simulator.prices().size();
+
+                statistics_type::collector actual;
+                cache(config, strategy, manager, actual);
+                BOOST_REQUIRE(expect.get().total_open_orders()>0);
+                require_equal(actual.get(), expect.get());
+            }
+        }
+        BOOST_REQUIRE_EQUAL(cache.size(), 2);
+        return stopped_count;
+    }
+
+    BOOST_AUTO_TEST_CASE(equivalence_test)
+    {
+        trading::simulator simulator{cache_candles(0.0), 3, trading::candle::ohlc4{}, 0};
+        BOOST_REQUIRE_EQUAL(require_equivalent(simulator), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(minimum_equity_test)
+    {
+        trading::simulator simulator{cache_candles(0.04), 3, trading::candle::ohlc4{}, 9'000};
+        BOOST_REQUIRE(require_equivalent(simulator)>0);
+    }
+
+    BOOST_AUTO_TEST_CASE(compression_test)
+    {
+        trading::simulator simulator{cache_candles(0.0), 3, trading::candle::ohlc4{}, 5'000};
+        trading::bazooka::event_cache<n_levels> cache{simulator};
+        config_type config{trading::bazooka::indicator_tag::sma, 12, {{{19, 20}, {18, 20}, {16, 20}}},
+                           {{{1, 3}, {1, 3}, {1, 3}}}};
+        auto log = cache.events(config, create_strategy(config));
+        BOOST_REQUIRE(!log->events.empty());
+        BOOST_REQUIRE_EQUAL(log->extreme_ends.size(), log->events.size());
+        BOOST_REQUIRE(log->extremes.size()<simulator.prices().size());
+        BOOST_REQUIRE(log->depth>0 && log->depth<=n_levels);
+        BOOST_REQUIRE(cache.events(config, create_strategy(config))==log);
+    }
+
+    BOOST_AUTO_TEST_CASE(replay_ticks_test)
+    {
+        for (double decline: {0.0, 0.04}) {
+            trading::simulator simulator{cache_candles(decline), 3, trading::candle::ohlc4{}, 9'000};
+            trading::bazooka::segmented_recorder<n_levels> recorder{simulator, 8};
+            trading::bazooka::event_cache<n_levels> cache{simulator};
+            cache.use(recorder);
+
+            config_type config{trading::bazooka::indicator_tag::ema, 12, {{{19, 20}, {18, 20}, {16, 20}}},
+                               {{{1, 6}, {1, 6}, {4, 6}}}};
+            auto strategy = create_strategy(config);
+            auto manager = create_manager(config);
+
+            statistics_type::collector expect_stats, actual_stats;
+            trading::chart_series<n_levels>::collector expect_series, actual_series;
+            tick_counter expect_counter, actual_counter;
+            simulator(trading::bazooka::trader{strategy, manager}, expect_stats, expect_series, expect_counter);
+            cache.replay_ticks(config, strategy, manager, actual_stats, actual_series, actual_counter);
+
+            BOOST_REQUIRE(expect_stats.get().total_open_orders()>0);
+            require_equal(actual_stats.get(), expect_stats.get());
+            BOOST_REQUIRE_EQUAL(actual_counter.count, expect_counter.count);
+
+            auto expect = expect_series.get(), actual = actual_series.get();
+            BOOST_REQUIRE(actual.open_order==expect.open_order);
+            BOOST_REQUIRE(actual.close_order==expect.close_order);
+            BOOST_REQUIRE(actual.close_balance==expect.close_balance);
+            BOOST_REQUIRE(actual.equity==expect.equity);
+            BOOST_REQUIRE(actual.entry==expect.entry);
+            BOOST_REQUIRE(actual.exit==expect.exit);
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_BAZOOKA_EVENT_CACHE_HPP
@@ -0,0 +1,129 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_BAZOOKA_LIVE_ENGINE_HPP
+#define BACKTESTING_TEST_BAZOOKA_LIVE_ENGINE_HPP
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <trading/bazooka/live_engine.hpp>
+#include <trading/bazooka/strategy.hpp>
+#include <trading/bazooka/trader.hpp>
+#include <trading/simulator.hpp>
+
+BOOST_AUTO_TEST_SUITE(bazooka_live_engine_test)
+    constexpr std::size_t n_levels{3};
+    using config_type = trading::bazooka::configuration<n_levels>;
+    using engine_type = trading::bazooka::live_engine<n_levels>;
+
+    // declining prices with a few missing candles
+    std::vector<trading::candle> live_candles()
+    {
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<3'000; i++) {
+            if (i%389==7) continue;
+            auto close = static_cast<trading::price_t>(100.0+15.0*std::sin(i/47.0)+5.0*std::sin(i/5.0)-0.01*i);
+            candles.emplace_back(trading::candle{i*60, close, close+1, close-1, close});
+        }
+        return candles;
+    }
+
+    std::vector<config_type> live_configs()
+    {
+        std::vector<config_type> configs;
+        for (auto tag: {trading::bazooka::indicator_tag::sma, trading::bazooka::indicator_tag::ema})
+            for (std::size_t period: {4, 9})
+                for (const auto& levels: std::array<std::array<trading::fraction_t, n_levels>, 2>{{
+                        {{{99, 100}, {97, 100}, {94, 100}}},
+                        {{{19, 20}, {18, 20}, {16, 20}}}}})
+                    for (const auto& sizes: std::array<std::array<trading::fraction_t, n_levels>, 2>{{
+                            {{{1, 3}, {1, 3}, {1, 3}}},
+                            {{{4, 6}, {1, 6}, {1, 6}}}}})
+                        configs.emplace_back(config_type{tag, period, levels, sizes});
+        return configs;
+    }
+
+    struct tick_counter {
+        std::size_t count{0};
+
+        template<class Trader>
+        void started(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void decided(const Trader&, trading::action, const trading::price_point&)
+        {
+            count++;
+        }
+
+        template<class Trader>
+        void position_active(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void indicators_updated(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void finished(const Trader&, const trading::price_point&) { }
+    };
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        trading::market market{trading::wallet{10'000}};
+        trading::time_resampler resampler{180, 60};
+        BOOST_REQUIRE_THROW(engine_type({}, market, resampler, 0, 1, std::chrono::microseconds{100}),
+                std::invalid_argument);
+        BOOST_REQUIRE_THROW(engine_type(live_configs(), market, resampler, 0, 0, std::chrono::microseconds{100}),
+                std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(equivalence_test)
+    {
+        auto candles = live_candles();
+        auto configs = live_configs();
+        trading::fraction_t fee{1, 100};
+        trading::market market{trading::wallet{10'000}, fee, fee};
+        trading::time_resampler resampler{180, 60};
+        trading::amount_t min_equity{9'000};
+
+        engine_type engine{configs, market, resampler, min_equity, 5, std::chrono::seconds{1}};
+        BOOST_REQUIRE_EQUAL(engine.size(), configs.size());
+        BOOST_REQUIRE_EQUAL(engine.indicator_count(), 4);
+        for (const auto& candle: candles)
+            engine(candle);
+        BOOST_REQUIRE_EQUAL(engine.candle_count(), candles.size());
+        BOOST_REQUIRE_EQUAL(engine.overrun_count(), 0);
+
+        trading::simulator simulator{candles, resampler, trading::candle::ohlc4{}, min_equity};
+        std::size_t stopped_count{0};
+        for (std::size_t i{0}; i<configs.size(); i++) {
+            trading::bazooka::indicator indic;
+            if (configs[i].tag==trading::bazooka::indicator_tag::ema)
+                indic = trading::ema{configs[i].period};
+            else
+                indic = trading::sma{configs[i].period};
+            trading::bazooka::trader trader{trading::bazooka::strategy{indic, indic, configs[i].levels},
+                                            trading::bazooka::manager{market, trading::order_sizer{configs[i].sizes}}};
+            tick_counter counter;
+            simulator(trader, counter);
+
+            bool stopped = counter.count<candles.size();
+            stopped_count += stopped;
+            BOOST_REQUIRE_EQUAL(engine.stopped(i), stopped);
+            BOOST_REQUIRE_EQUAL(engine.next_entry_level(i), trader.next_entry_level());
+            BOOST_REQUIRE_EQUAL(engine.manager(i).wallet_balance(), trader.wallet_balance());
+            if (!stopped)
+                BOOST_REQUIRE_EQUAL(engine.equity(i), trader.equity(candles.back().close()));
+        }
+        BOOST_REQUIRE(stopped_count>0 && stopped_count<configs.size());
+
+        const auto& top = engine.top();
+        BOOST_REQUIRE_EQUAL(top.size(), 5);
+        for (std::size_t i{1}; i<top.size(); i++)
+            BOOST_REQUIRE(engine.equity(top[i-1])>=engine.equity(top[i]));
+        for (std::size_t i{0}; i<configs.size(); i++)
+            if (std::find(top.begin(), top.end(), i)==top.end())
+                BOOST_REQUIRE(engine.equity(i)<=engine.equity(top.back()));
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_BAZOOKA_LIVE_ENGINE_HPP
@@ -0,0 +1,69 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_BAZOOKA_SEARCH_SPACE_HPP
+#define BACKTESTING_TEST_BAZOOKA_SEARCH_SPACE_HPP
+
+#include <boost/test/unit_test.hpp>
+#include <trading/bazooka/search_space.hpp>
+
+BOOST_AUTO_TEST_SUITE(bazooka_search_space_test)
+    constexpr std::size_t n_levels{3};
+    using search_space_t = trading::bazooka::search_space<n_levels>;
+    using config_t = trading::bazooka::configuration<n_levels>;
+
+    search_space_t create_search_space()
+    {
+        return search_space_t{trading::systematic::int_range_generator{3, 15, 3},
+                              {trading::bazooka::indicator_tag::sma, trading::bazooka::indicator_tag::ema},
+                              trading::systematic::levels_generator<n_levels>{6, {15, 20}},
+                              trading::systematic::sizes_generator<n_levels>{3}};
+    }
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        auto space = create_search_space();
+        auto periods = space.periods();
+        auto levels = space.levels();
+        auto sizes = space.sizes();
+
+        std::vector<config_t> expect;
+        for (int period: periods())
+            for (const auto& tag: space.tags())
+                for (const auto& curr_levels: levels())
+                    for (const auto& curr_sizes: sizes())
+                        expect.emplace_back(config_t{tag, static_cast<std::size_t>(period), curr_levels, curr_sizes});
+
+        BOOST_REQUIRE_EQUAL(space.size(), expect.size());
+        for (std::size_t i{0}; i<expect.size(); i++) {
+            BOOST_REQUIRE(space.at(i)==expect[i]);
+            BOOST_REQUIRE_EQUAL(space.index_of(expect[i]), i);
+        }
+        BOOST_REQUIRE_THROW(space.at(expect.size()), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(range_test)
+    {
+        auto space = create_search_space();
+        std::size_t begin{space.size()/3}, index{begin};
+        for (const auto& config: space.range(begin, begin+100))
+            BOOST_REQUIRE(config==space.at(index++));
+        BOOST_REQUIRE_EQUAL(index, begin+100);
+
+        // the end is clamped to the size
+        index = space.size()-10;
+        for (const auto& config: space.range(index, space.size()+10))
+            BOOST_REQUIRE(config==space.at(index++));
+        BOOST_REQUIRE_EQUAL(index, space.size());
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(search_space_t(trading::systematic::int_range_generator{3, 15, 3}, {},
+                trading::systematic::levels_generator<n_levels>{6},
+                trading::systematic::sizes_generator<n_levels>{3}), std::invalid_argument);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_BAZOOKA_SEARCH_SPACE_HPP
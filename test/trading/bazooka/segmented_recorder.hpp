@@ -0,0 +1,91 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_BAZOOKA_SEGMENTED_RECORDER_HPP
+#define BACKTESTING_TEST_BAZOOKA_SEGMENTED_RECORDER_HPP
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <trading/bazooka/segmented_recorder.hpp>
+#include <trading/bazooka/event_cache.hpp>
+#include <trading/simulator.hpp>
+#include <trading/sma.hpp>
+#include <trading/ema.hpp>
+
+BOOST_AUTO_TEST_SUITE(bazooka_segmented_recorder_test)
+    constexpr std::size_t n_levels{3};
+    using config_type = trading::bazooka::configuration<n_levels>;
+
+    std::vector<trading::candle> segment_candles()
+    {
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<3'000; i++) {
+            auto close = static_cast<trading::price_t>(100.0+20.0*std::sin(i/53.0)+6.0*std::sin(i/4.0));
+            candles.emplace_back(trading::candle{i*60, close, close+1, close-1, close});
+        }
+        return candles;
+    }
+
+    auto create_strategy(const config_type& config)
+    {
+        trading::bazooka::indicator indic;
+        if (config.tag==trading::bazooka::indicator_tag::ema)
+            indic = trading::ema{config.period};
+        else
+            indic = trading::sma{config.period};
+        return trading::bazooka::strategy{indic, indic, config.levels};
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        trading::simulator simulator{segment_candles(), 3, trading::candle::ohlc4{}, 0};
+        BOOST_REQUIRE_THROW(trading::bazooka::segmented_recorder<n_levels>(simulator, 0), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(equivalence_test)
+    {
+        trading::simulator simulator{segment_candles(), 3, trading::candle::ohlc4{}, 0};
+        trading::bazooka::event_cache<n_levels> cache{simulator};
+        std::array<std::array<trading::fraction_t, n_levels>, 2> levels{{
+                {{{19, 20}, {18, 20}, {16, 20}}},
+                {{{99, 100}, {97, 100}, {95, 100}}},
+        }};
+
+        for (auto tag: {trading::bazooka::indicator_tag::sma, trading::bazooka::indicator_tag::ema}) {
+            for (const auto& curr_levels: levels) {
+                config_type config{tag, 10, curr_levels, {{{1, 3}, {1, 3}, {1, 3}}}};
+                auto strategy = create_strategy(config);
+                const auto& expect = cache.events(config, strategy)->events;
+                BOOST_REQUIRE(!expect.empty());
+
+                for (std::size_t segment_count: {1, 2, 7, 64, 5'000}) {
+                    trading::bazooka::segmented_recorder<n_levels> recorder{simulator, segment_count};
+                    auto actual = recorder(strategy);
+                    BOOST_REQUIRE_EQUAL(actual.size(), expect.size());
+                    for (std::size_t i{0}; i<expect.size(); i++)
+                        BOOST_REQUIRE(actual[i]==expect[i]);
+                }
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(event_cache_test)
+    {
+        trading::simulator simulator{segment_candles(), 3, trading::candle::ohlc4{}, 0};
+        config_type config{trading::bazooka::indicator_tag::sma, 10, {{{99, 100}, {97, 100}, {95, 100}}},
+                           {{{1, 3}, {1, 3}, {1, 3}}}};
+        trading::bazooka::event_cache<n_levels> expect{simulator}, actual{simulator};
+        trading::bazooka::segmented_recorder<n_levels> recorder{simulator, 16};
+        actual.use(recorder);
+
+        auto expect_log = expect.events(config, create_strategy(config));
+        auto actual_log = actual.events(config, create_strategy(config));
+        BOOST_REQUIRE(actual_log->events==expect_log->events);
+        BOOST_REQUIRE(actual_log->extremes==expect_log->extremes);
+        BOOST_REQUIRE(actual_log->extreme_ends==expect_log->extreme_ends);
+        BOOST_REQUIRE_EQUAL(actual_log->depth, expect_log->depth);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_BAZOOKA_SEGMENTED_RECORDER_HPP
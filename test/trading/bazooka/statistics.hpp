@@ -5,8 +5,15 @@
 #ifndef BACKTESTING_TEST_BAZOOKA_STATISTICS_HPP
 #define BACKTESTING_TEST_BAZOOKA_STATISTICS_HPP
 
+#include <cmath>
 #include <boost/test/unit_test.hpp>
 #include <trading/bazooka/statistics.hpp>
+#include <trading/bazooka/trader.hpp>
+#include <trading/bazooka/manager.hpp>
+#include <trading/bazooka/event_cache.hpp>
+#include <trading/bazooka/strategy.hpp>
+#include <trading/simulator.hpp>
+#include <trading/sma.hpp>
 
 BOOST_AUTO_TEST_SUITE(bazooka_statistics_test)
     BOOST_AUTO_TEST_CASE(increase_open_order_count_test)
@@ -24,6 +31,158 @@ BOOST_AUTO_TEST_SUITE(bazooka_statistics_test)
         BOOST_REQUIRE_EQUAL(stats.open_order_counts()[0], 1);
         BOOST_REQUIRE_EQUAL(stats.open_order_counts()[1], 1);
     }
+
+    BOOST_AUTO_TEST_CASE(windowed_collector_test)
+    {
+        constexpr std::size_t n_levels{3};
+        BOOST_REQUIRE_THROW(trading::bazooka::statistics<n_levels>::windowed_collector({}), std::invalid_argument);
+        BOOST_REQUIRE_THROW(trading::bazooka::statistics<n_levels>::windowed_collector({60, 60}),
+                std::invalid_argument);
+
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<3'000; i++) {
+            auto close = static_cast<trading::price_t>(100.0+20.0*std::sin(i/53.0)+6.0*std::sin(i/4.0));
+            candles.emplace_back(trading::candle{i*60, close, close+1, close-1, close});
+        }
+        trading::simulator simulator{candles, 3, trading::candle::ohlc4{}, 0};
+        std::array<trading::fraction_t, n_levels> levels{{{99, 100}, {97, 100}, {95, 100}}};
+        std::array<trading::fraction_t, n_levels> sizes{{{1, 3}, {1, 3}, {1, 3}}};
+        trading::bazooka::indicator indic{trading::sma{10}};
+        trading::fraction_t fee{1, 100};
+        trading::market market{trading::wallet{10'000}, fee, fee};
+        trading::bazooka::trader trader{trading::bazooka::strategy{indic, indic, levels},
+                                        trading::bazooka::manager{market, trading::order_sizer{sizes}}};
+
+        trading::bazooka::statistics<n_levels>::collector expect;
+        trading::bazooka::statistics<n_levels>::windowed_collector actual{{0, 60'000, 120'000, 1'000'000}};
+        simulator(trader, expect, actual);
+        auto windowed = actual.get();
+
+        BOOST_REQUIRE_EQUAL(windowed.total.final_balance(), expect.get().final_balance());
+        BOOST_REQUIRE_EQUAL(windowed.total.total_open_orders(), expect.get().total_open_orders());
+        BOOST_REQUIRE_EQUAL(windowed.windows.size(), 3);
+
+        std::size_t open_orders{0}, close_orders{0}, win_count{0}, loss_count{0};
+        for (std::size_t w{0}; w<windowed.windows.size(); w++) {
+            const auto& stats = windowed.windows[w].stats;
+            BOOST_REQUIRE_EQUAL(windowed.windows[w].from, w*60'000);
+            BOOST_REQUIRE(stats.total_open_orders()>0);
+            BOOST_REQUIRE(stats.min_equity()>=expect.get().min_equity());
+            BOOST_REQUIRE(stats.max_equity()<=expect.get().max_equity());
+            if (w) BOOST_REQUIRE_EQUAL(stats.init_balance(), windowed.windows[w-1].stats.final_balance());
+            open_orders += stats.total_open_orders();
+            close_orders += stats.total_close_all_orders();
+            win_count += stats.win_count();
+            loss_count += stats.loss_count();
+        }
+        BOOST_REQUIRE_EQUAL(open_orders, expect.get().total_open_orders());
+        BOOST_REQUIRE_EQUAL(close_orders, expect.get().total_close_all_orders());
+        BOOST_REQUIRE_EQUAL(win_count, expect.get().win_count());
+        BOOST_REQUIRE_EQUAL(loss_count, expect.get().loss_count());
+        BOOST_REQUIRE_EQUAL(windowed.windows.back().stats.final_balance(),
+                trader.equity(simulator.prices().back().data));
+    }
+
+    BOOST_AUTO_TEST_CASE(windowed_boundary_test)
+    {
+        // the position is opened in the first window and closed in the second one
+        constexpr std::size_t n_levels{3};
+        std::array<trading::fraction_t, n_levels> sizes{{{1, 3}, {1, 3}, {1, 3}}};
+        trading::fraction_t fee{1, 100};
+        trading::market market{trading::wallet{10'000}, fee, fee};
+        trading::bazooka::replay_trader trader{trading::bazooka::manager{market, trading::order_sizer{sizes}}};
+        std::vector<std::pair<trading::price_point, trading::action>> ticks{
+                {{0, 100}, trading::action::opened},
+                {{60, 100}, trading::action::none},
+                {{120, 120}, trading::action::none},
+                {{180, 150}, trading::action::closed_all}
+        };
+
+        trading::bazooka::statistics<n_levels>::collector expect;
+        trading::bazooka::statistics<n_levels>::windowed_collector actual{{0, 120}};
+        expect.started(trader, ticks.front().first);
+        actual.started(trader, ticks.front().first);
+
+        for (const auto& [point, done]: ticks) {
+            trader(done, point);
+            expect.decided(trader, done, point);
+            actual.decided(trader, done, point);
+            if (trader.position_active()) {
+                expect.position_active(trader, point);
+                actual.position_active(trader, point);
+            }
+        }
+        expect.finished(trader, ticks.back().first);
+        actual.finished(trader, ticks.back().first);
+        auto windowed = actual.get();
+        BOOST_REQUIRE_EQUAL(windowed.windows.size(), 2);
+
+        // the first window ends at the equity of the open position, the second one starts with it
+        const auto& first = windowed.windows[0].stats;
+        const auto& second = windowed.windows[1].stats;
+        BOOST_REQUIRE(first.total_profit<trading::amount>()>0);
+        BOOST_REQUIRE(second.total_profit<trading::amount>()>0);
+        BOOST_REQUIRE_EQUAL(second.init_balance(), first.final_balance());
+        BOOST_REQUIRE_CLOSE(first.total_profit<trading::amount>()+second.total_profit<trading::amount>(),
+                expect.get().total_profit<trading::amount>(), 1e-3);
+        BOOST_REQUIRE_EQUAL(second.net_profit(), expect.get().net_profit());
+        BOOST_REQUIRE_EQUAL(first.total_close_all_orders(), 0);
+        BOOST_REQUIRE_EQUAL(second.total_close_all_orders(), 1);
+        BOOST_REQUIRE_EQUAL(second.win_count(), 1);
+        BOOST_REQUIRE_GE(first.min_equity(), expect.get().min_equity());
+        BOOST_REQUIRE_LE(second.max_equity(), expect.get().max_equity());
+    }
+    BOOST_AUTO_TEST_CASE(windowed_boundary_close_test)
+    {
+        // the position is closed exactly on a boundary, so it is counted in the window it was opened in
+        // and the next window opens at the balance after the close
+        constexpr std::size_t n_levels{3};
+        std::array<trading::fraction_t, n_levels> sizes{{{1, 3}, {1, 3}, {1, 3}}};
+        trading::fraction_t fee{1, 100};
+        trading::market market{trading::wallet{10'000}, fee, fee};
+        trading::bazooka::replay_trader trader{trading::bazooka::manager{market, trading::order_sizer{sizes}}};
+        std::vector<std::pair<trading::price_point, trading::action>> ticks{
+                {{0, 100}, trading::action::opened},
+                {{60, 120}, trading::action::none},
+                {{120, 150}, trading::action::closed_all},
+                {{180, 140}, trading::action::opened},
+                {{240, 150}, trading::action::none}
+        };
+
+        trading::bazooka::statistics<n_levels>::collector expect;
+        trading::bazooka::statistics<n_levels>::windowed_collector actual{{0, 120}};
+        expect.started(trader, ticks.front().first);
+        actual.started(trader, ticks.front().first);
+
+        trading::amount_t close_balance{0};
+        for (const auto& [point, done]: ticks) {
+            trader(done, point);
+            if (done==trading::action::closed_all) close_balance = trader.wallet_balance();
+            expect.decided(trader, done, point);
+            actual.decided(trader, done, point);
+            if (trader.position_active()) {
+                expect.position_active(trader, point);
+                actual.position_active(trader, point);
+            }
+        }
+        expect.finished(trader, ticks.back().first);
+        actual.finished(trader, ticks.back().first);
+        auto windowed = actual.get();
+        BOOST_REQUIRE_EQUAL(windowed.windows.size(), 2);
+
+        const auto& first = windowed.windows[0].stats;
+        const auto& second = windowed.windows[1].stats;
+        BOOST_REQUIRE_EQUAL(first.total_close_all_orders(), 1);
+        BOOST_REQUIRE_EQUAL(first.win_count(), 1);
+        BOOST_REQUIRE_EQUAL(first.total_open_orders(), 1);
+        BOOST_REQUIRE_EQUAL(first.final_balance(), close_balance);
+        BOOST_REQUIRE_EQUAL(first.net_profit(), expect.get().net_profit());
+        BOOST_REQUIRE_EQUAL(second.net_profit(), 0);
+        BOOST_REQUIRE_EQUAL(second.init_balance(), close_balance);
+        BOOST_REQUIRE_EQUAL(second.total_close_all_orders(), 0);
+        BOOST_REQUIRE_EQUAL(second.total_open_orders(), 1);
+        BOOST_REQUIRE_EQUAL(second.win_count(), 0);
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_BAZOOKA_STATISTICS_HPP
@@ -82,6 +82,64 @@ BOOST_AUTO_TEST_SUITE(brute_force_optimizer_test)
         BOOST_REQUIRE_EQUAL(result.get().value, init.value);
         BOOST_REQUIRE_EQUAL(updated_count, 0);
     }
+
+    struct indexed_space {
+        std::size_t size() const
+        {
+            return 10'000;
+        }
+
+        int at(std::size_t index) const
+        {
+            return static_cast<int>(index*7'919%10'000);
+        }
+    };
+
+    BOOST_AUTO_TEST_CASE(chunked_top_k_test)
+    {
+        auto comp = [](const auto& lhs, const auto& rhs) { return lhs.value>rhs.value; };
+        auto constraints = [](const auto& state) { return state.config%3!=0; };
+
+        trading::enumerative_result<state_t, decltype(comp)> expect{10, comp};
+        indexed_space space;
+        for (std::size_t i{0}; i<space.size(); i++)
+            if (auto state = objective(space.at(i)); constraints(state))
+                expect.update(state);
+
+        auto generated = [&]() -> cppcoro::generator<int> {
+            for (std::size_t i{0}; i<space.size(); i++)
+                co_yield space.at(i);
+        };
+
+        auto same = [&](const auto& result) {
+            auto actual = result.get();
+            auto expected = expect.get();
+            BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+            for (std::size_t i{0}; i<actual.size(); i++)
+                BOOST_REQUIRE_EQUAL(actual[i].config, expected[i].config);
+        };
+
+        for (std::size_t thread_count: {1, 3, 8})
+            for (std::size_t chunk_size: {1, 64, 20'000}) {
+                optimizer_t optimizer{thread_count, chunk_size};
+                BOOST_REQUIRE_EQUAL(optimizer.thread_count(), thread_count);
+                BOOST_REQUIRE_EQUAL(optimizer.chunk_size(), chunk_size);
+
+                trading::enumerative_result<state_t, decltype(comp)> random_access{10, comp};
+                optimizer(random_access, constraints, objective, space);
+                same(random_access);
+
+                trading::enumerative_result<state_t, decltype(comp)> sequential{10, comp};
+                optimizer(sequential, constraints, objective, generated);
+                same(sequential);
+            }
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(optimizer_t(0), std::invalid_argument);
+        BOOST_REQUIRE_THROW(optimizer_t(1, 0), std::invalid_argument);
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_BRUTE_FORCE_OPTIMIZER_HPP
@@ -0,0 +1,149 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_SHARDED_BRUTE_FORCE_OPTIMIZER_HPP
+#define BACKTESTING_TEST_SHARDED_BRUTE_FORCE_OPTIMIZER_HPP
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <filesystem>
+#include <boost/test/unit_test.hpp>
+#include <trading/brute_force/sharded/optimizer.hpp>
+#include <trading/result.hpp>
+#include <trading/state.hpp>
+
+BOOST_AUTO_TEST_SUITE(sharded_brute_force_optimizer_test)
+    using state_t = trading::state<int>;
+    using optimizer_t = trading::brute_force::sharded::optimizer<state_t>;
+    auto objective = [](const auto& config) { return state_t{config, static_cast<double>(config*37%1'000)}; };
+    auto constraints = [](const auto& state) { return state.config%2==0; };
+    auto comp = [](const auto& lhs, const auto& rhs) { return lhs.value>rhs.value; };
+    using result_t = trading::enumerative_result<state_t, decltype(comp)>;
+
+    struct indexed_space {
+        std::size_t size() const
+        {
+            return 1'000;
+        }
+
+        int at(std::size_t index) const
+        {
+            return static_cast<int>(index);
+        }
+    };
+
+    std::filesystem::path create_dir()
+    {
+        auto dir = std::filesystem::temp_directory_path()/"backtesting-shards";
+        std::filesystem::remove_all(dir);
+        return dir;
+    }
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        auto dir = create_dir();
+        indexed_space space;
+        result_t empty{5, comp};
+        std::size_t worker_count{3}, shard_size{64};
+        optimizer_t first{dir, shard_size, 0, worker_count}, second{dir, shard_size, 1, worker_count},
+                third{dir, shard_size, 2, worker_count};
+        BOOST_REQUIRE_EQUAL(first.shard_count(space.size()), 16);
+
+        BOOST_REQUIRE_EQUAL(first(empty, constraints, objective, space), 6);
+        BOOST_REQUIRE_EQUAL(second(empty, constraints, objective, space), 5);
+        BOOST_REQUIRE(!first.completed_all(space.size()));
+        result_t merged{5, comp};
+        BOOST_REQUIRE_THROW(first.merge(merged, constraints, objective, space.size()), std::runtime_error);
+
+        BOOST_REQUIRE_EQUAL(third(empty, constraints, objective, space), 5);
+        BOOST_REQUIRE(first.completed_all(space.size()));
+        first.merge(merged, constraints, objective, space.size());
+
+        result_t expect{5, comp};
+        for (std::size_t i{0}; i<space.size(); i++)
+            if (auto state = objective(space.at(i)); constraints(state))
+                expect.update(state);
+
+        auto actual = merged.get(), expected = expect.get();
+        BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+        for (std::size_t i{0}; i<actual.size(); i++)
+            BOOST_REQUIRE_EQUAL(actual[i].config, expected[i].config);
+        std::filesystem::remove_all(dir);
+    }
+
+    BOOST_AUTO_TEST_CASE(resume_test)
+    {
+        auto dir = create_dir();
+        indexed_space space;
+        result_t empty{5, comp};
+        optimizer_t optimizer{dir, 100};
+        BOOST_REQUIRE_EQUAL(optimizer(empty, constraints, objective, space), 10);
+        BOOST_REQUIRE_EQUAL(optimizer(empty, constraints, objective, space), 0);
+
+        // an interrupted shard has no completion marker
+        std::filesystem::remove(dir/"shard-4.done");
+        BOOST_REQUIRE(!optimizer.completed(4));
+        BOOST_REQUIRE_EQUAL(optimizer(empty, constraints, objective, space), 1);
+        BOOST_REQUIRE(optimizer.completed_all(space.size()));
+        std::filesystem::remove_all(dir);
+    }
+
+    BOOST_AUTO_TEST_CASE(manifest_test)
+    {
+        auto dir = create_dir();
+        indexed_space space;
+        result_t empty{5, comp};
+        optimizer_t optimizer{dir, 100, 0, 1, "sma"};
+        BOOST_REQUIRE_EQUAL(optimizer(empty, constraints, objective, space), 10);
+        BOOST_REQUIRE(std::filesystem::exists(dir/"manifest.json"));
+
+        // the same run is resumed, the others are refused
+        BOOST_REQUIRE_EQUAL(optimizer_t(dir, 100, 0, 1, "sma")(empty, constraints, objective, space), 0);
+        BOOST_REQUIRE_THROW(optimizer_t(dir, 100, 0, 1, "ema")(empty, constraints, objective, space),
+                std::runtime_error);
+        BOOST_REQUIRE_THROW(optimizer_t(dir, 50, 0, 1, "sma")(empty, constraints, objective, space),
+                std::runtime_error);
+
+        result_t merged{5, comp};
+        BOOST_REQUIRE_THROW(optimizer.merge(merged, constraints, objective, space.size()/2), std::runtime_error);
+        optimizer.merge(merged, constraints, objective, space.size());
+        BOOST_REQUIRE_EQUAL(merged.get().size(), 5);
+        std::filesystem::remove_all(dir);
+    }
+
+    BOOST_AUTO_TEST_CASE(claim_merge_test)
+    {
+        auto dir = create_dir();
+        std::size_t worker_count{8};
+        std::atomic<std::size_t> claimed_count{0};
+        {
+            std::vector<std::jthread> workers;
+            for (std::size_t i{0}; i<worker_count; i++)
+                workers.emplace_back([&, i] {
+                    if (optimizer_t{dir, 100, i, worker_count}.claim_merge())
+                        claimed_count++;
+                });
+        }
+        BOOST_REQUIRE_EQUAL(claimed_count, 1);
+
+        // the owner claims it again after a restart, the others never do
+        auto owner = optimizer_t{dir, 100, 0, worker_count}.merge_owner();
+        BOOST_REQUIRE(owner.has_value());
+        BOOST_REQUIRE(optimizer_t(dir, 100, *owner, worker_count).claim_merge());
+        BOOST_REQUIRE(!optimizer_t(dir, 100, (*owner+1)%worker_count, worker_count).claim_merge());
+        std::filesystem::remove_all(dir);
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        auto dir = create_dir();
+        BOOST_REQUIRE_THROW(optimizer_t(dir, 0), std::invalid_argument);
+        BOOST_REQUIRE_THROW(optimizer_t(dir, 10, 0, 0), std::invalid_argument);
+        BOOST_REQUIRE_THROW(optimizer_t(dir, 10, 2, 2), std::invalid_argument);
+        std::filesystem::remove_all(dir);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_SHARDED_BRUTE_FORCE_OPTIMIZER_HPP
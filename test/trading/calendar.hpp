@@ -0,0 +1,39 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_CALENDAR_HPP
+#define BACKTESTING_TEST_CALENDAR_HPP
+
+#include <boost/test/unit_test.hpp>
+#include <trading/calendar.hpp>
+
+BOOST_AUTO_TEST_SUITE(calendar_test)
+    // 2020-02-15 12:00:00 UTC and 2021-03-01 00:00:00 UTC
+    constexpr std::time_t from{1'581'768'000}, to{1'614'556'800};
+
+    BOOST_AUTO_TEST_CASE(monthly_boundaries_test)
+    {
+        BOOST_REQUIRE_THROW(trading::monthly_boundaries(from, to, 0), std::invalid_argument);
+
+        auto boundaries = trading::monthly_boundaries(from, to);
+        BOOST_REQUIRE_EQUAL(boundaries.size(), 14);
+        BOOST_REQUIRE_EQUAL(boundaries.front(), 1'580'515'200);  // 2020-02-01
+        BOOST_REQUIRE_EQUAL(boundaries[1], 1'583'020'800);       // 2020-03-01, leap year
+        BOOST_REQUIRE_EQUAL(boundaries.back(), to);
+
+        auto quarters = trading::monthly_boundaries(from, to, 3);
+        BOOST_REQUIRE_EQUAL(quarters.size(), 5);
+        BOOST_REQUIRE_EQUAL(quarters[1], 1'588'291'200);         // 2020-05-01
+    }
+
+    BOOST_AUTO_TEST_CASE(yearly_boundaries_test)
+    {
+        auto boundaries = trading::yearly_boundaries(from, to);
+        BOOST_REQUIRE_EQUAL(boundaries.size(), 2);
+        BOOST_REQUIRE_EQUAL(boundaries[0], 1'577'836'800);       // 2020-01-01
+        BOOST_REQUIRE_EQUAL(boundaries[1], 1'609'459'200);       // 2021-01-01
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_CALENDAR_HPP
@@ -26,6 +26,13 @@ BOOST_AUTO_TEST_SUITE(candle_test)
         BOOST_REQUIRE_THROW(trading::candle(opened, 7., 5., 10., 7.), std::invalid_argument);
     }
 
+    BOOST_AUTO_TEST_CASE(trusted_constructor_test)
+    {
+        trading::candle candle{trading::candle::trusted, 0, 11., 10., 5., 7.};
+        BOOST_REQUIRE_EQUAL(candle.open(), 11.);
+        BOOST_REQUIRE_EQUAL(candle.high(), 10.);
+    }
+
     BOOST_AUTO_TEST_CASE(getter_test)
     {
         std::time_t opened{0};
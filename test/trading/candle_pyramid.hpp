@@ -0,0 +1,84 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_CANDLE_PYRAMID_HPP
+#define BACKTESTING_TEST_CANDLE_PYRAMID_HPP
+
+#include <boost/test/unit_test.hpp>
+#include <trading/candle_pyramid.hpp>
+#include <trading/time_resampler.hpp>
+#include <trading/candle.hpp>
+
+BOOST_AUTO_TEST_SUITE(candle_pyramid_test)
+    std::vector<trading::candle> pyramid_candles()
+    {
+        // missing candle at 300
+        return {
+                {0, 5'000, 15'000, 2'500, 10'000},
+                {60, 10'100, 12'000, 8'500, 11'000},
+                {120, 10'900, 17'000, 9'900, 13'000},
+                {180, 12'000, 20'000, 11'500, 18'000},
+                {240, 17'500, 20'300, 13'500, 16'400},
+                {360, 17'000, 25'000, 15'500, 23'400},
+                {420, 23'000, 24'000, 21'500, 22'000},
+                {480, 22'000, 23'000, 20'500, 21'000},
+        };
+    }
+
+    BOOST_AUTO_TEST_CASE(equivalence_test)
+    {
+        auto candles = pyramid_candles();
+        trading::candle_pyramid pyramid{candles, 1'000'000};
+
+        // built from the finer timeframe
+        auto fine = pyramid(120);
+        auto coarse = pyramid(240);
+
+        trading::candle_pyramid direct{candles, 1'000'000};
+        auto expect = direct(240);
+        BOOST_REQUIRE_EQUAL(coarse->candles.size(), expect->candles.size());
+
+        for (std::size_t i{0}; i<coarse->candles.size(); i++) {
+            BOOST_REQUIRE_EQUAL(coarse->candles[i], expect->candles[i]);
+            BOOST_REQUIRE_EQUAL(coarse->ends[i], expect->ends[i]);
+        }
+
+        auto resampled = trading::time_resampler{240, 60}(candles);
+        BOOST_REQUIRE_EQUAL(resampled.size(), coarse->candles.size());
+
+        for (std::size_t i{0}; i<resampled.size(); i++) {
+            BOOST_REQUIRE_EQUAL(resampled[i].value, coarse->candles[i]);
+            BOOST_REQUIRE_EQUAL(resampled[i].last, coarse->ends[i]);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(cache_test)
+    {
+        trading::candle_pyramid pyramid{pyramid_candles(), 1'000'000};
+        BOOST_REQUIRE(!pyramid.contains(120));
+        auto first = pyramid(120);
+        BOOST_REQUIRE(pyramid.contains(120));
+        BOOST_REQUIRE_EQUAL(pyramid.memory(), first->memory());
+        BOOST_REQUIRE(pyramid(120)==first);
+    }
+
+    BOOST_AUTO_TEST_CASE(eviction_test)
+    {
+        auto candles = pyramid_candles();
+        auto frame_memory = trading::candle_pyramid{candles, 1'000'000}(120)->memory();
+        trading::candle_pyramid pyramid{candles, frame_memory+frame_memory/2};
+
+        auto evicted = pyramid(120);
+        pyramid(180);
+        BOOST_REQUIRE(!pyramid.contains(120));
+        BOOST_REQUIRE(pyramid.contains(180));
+        BOOST_REQUIRE(pyramid.memory()<=pyramid.memory_budget());
+
+        // evicted timeframe stays valid
+        BOOST_REQUIRE_EQUAL(evicted->period, 120);
+        BOOST_REQUIRE_THROW(trading::candle_pyramid(candles, 1)(120), std::runtime_error);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_CANDLE_PYRAMID_HPP
@@ -0,0 +1,126 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_CANDLE_VALIDATOR_HPP
+#define BACKTESTING_TEST_CANDLE_VALIDATOR_HPP
+
+#include <map>
+#include <limits>
+#include <boost/test/unit_test.hpp>
+#include <trading/candle_validator.hpp>
+
+BOOST_AUTO_TEST_SUITE(candle_validator_test)
+    trading::candle_columns dirty_columns()
+    {
+        trading::candle_columns columns;
+        columns.emplace_back(0, 10, 12, 8, 11);
+        columns.emplace_back(60, 11, 10, 9, 10);     // open above high
+        columns.emplace_back(60, 10, 12, 9, 11);     // duplicate
+        columns.emplace_back(180, 11, 13, 10, 12);   // gap of 120 s
+        columns.emplace_back(120, 12, 13, 11, 12);   // out of order
+        columns.emplace_back(240, 12, 14, 11, std::numeric_limits<trading::price_t>::quiet_NaN());  // NaN close
+        columns.emplace_back(540, 12, 14, 11, 13);   // gap of 300 s
+        return columns;
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(trading::candle_validator(0), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(validate_test)
+    {
+        auto report = trading::candle_validator{}.validate(dirty_columns());
+        BOOST_REQUIRE_EQUAL(report.count, 7);
+        BOOST_REQUIRE_EQUAL(report.invalid_count, 2);
+        BOOST_REQUIRE_EQUAL(report.duplicate_count, 1);
+        BOOST_REQUIRE_EQUAL(report.unordered_count, 1);
+        BOOST_REQUIRE(!report.valid());
+        BOOST_REQUIRE_EQUAL(report.gaps.size(), 2);
+        BOOST_REQUIRE_EQUAL(report.gaps.at(120), 1);
+        BOOST_REQUIRE_EQUAL(report.gaps.at(300), 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(drop_test)
+    {
+        trading::validation_report report;
+        auto candles = trading::candle_validator{60, trading::cleaning_policy::drop}(dirty_columns(), report);
+        std::vector<std::time_t> expect{0, 60, 180, 540};
+        BOOST_REQUIRE_EQUAL(candles.size(), expect.size());
+        for (std::size_t i{0}; i<expect.size(); i++)
+            BOOST_REQUIRE_EQUAL(candles[i].opened(), expect[i]);
+        BOOST_REQUIRE_EQUAL(candles[1].open(), 10);
+        BOOST_REQUIRE_EQUAL(report.dropped_count, 3);
+        BOOST_REQUIRE_EQUAL(report.repaired_count, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(repair_test)
+    {
+        trading::validation_report report;
+        auto candles = trading::candle_validator{60, trading::cleaning_policy::repair}(dirty_columns(), report);
+        std::vector<std::time_t> expect{0, 60, 180, 540};
+        BOOST_REQUIRE_EQUAL(candles.size(), expect.size());
+        for (std::size_t i{0}; i<expect.size(); i++)
+            BOOST_REQUIRE_EQUAL(candles[i].opened(), expect[i]);
+        BOOST_REQUIRE_EQUAL(candles[1], trading::candle(60, 11, 11, 9, 10));
+        BOOST_REQUIRE_EQUAL(report.dropped_count, 3);
+        BOOST_REQUIRE_EQUAL(report.repaired_count, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(keep_test)
+    {
+        trading::validation_report report;
+        trading::candle_validator validator{60, trading::cleaning_policy::keep};
+        BOOST_REQUIRE_THROW(validator(dirty_columns(), report), std::invalid_argument);
+
+        trading::candle_columns columns;
+        columns.emplace_back(60, 10, 12, 8, 11);
+        columns.emplace_back(0, 10, 12, 8, 11);
+        auto candles = validator(columns, report);
+        BOOST_REQUIRE_EQUAL(candles.size(), 2);
+        BOOST_REQUIRE_EQUAL(report.unordered_count, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(order_test)
+    {
+        // both rows after the jump are earlier than the row at 180, although they are in order with each other
+        trading::candle_columns columns;
+        columns.emplace_back(0, 10, 12, 8, 11);
+        columns.emplace_back(180, 10, 12, 8, 11);
+        columns.emplace_back(60, 10, 12, 8, 11);
+        columns.emplace_back(120, 10, 12, 8, 11);
+        columns.emplace_back(180, 10, 12, 8, 11);
+        columns.emplace_back(240, 10, 12, 8, 11);
+        auto report = trading::candle_validator{}.validate(columns);
+        BOOST_REQUIRE_EQUAL(report.unordered_count, 2);
+        BOOST_REQUIRE_EQUAL(report.duplicate_count, 1);
+
+        // the step forward after the jump is measured from the row at 180, so it is no gap
+        BOOST_REQUIRE_EQUAL(report.gaps.size(), 1);
+        BOOST_REQUIRE_EQUAL(report.gaps.at(180), 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(gap_test)
+    {
+        // the gaps are the ones left between the cleaned candles
+        trading::candle_columns columns;
+        columns.emplace_back(0, 10, 12, 8, 11);
+        columns.emplace_back(60, 10, 12, 8, 11);
+        columns.emplace_back(60, 10, 12, 8, 11);
+        columns.emplace_back(0, 10, 12, 8, 11);
+        columns.emplace_back(300, 10, 12, 8, 11);
+        columns.emplace_back(360, 10, 12, 8, 11);
+        trading::validation_report report;
+        auto candles = trading::candle_validator{}(columns, report);
+
+        std::map<std::time_t, std::size_t> expect;
+        for (std::size_t i{1}; i<candles.size(); i++)
+            if (auto gap = candles[i].opened()-candles[i-1].opened(); gap>60)
+                expect[gap]++;
+        BOOST_REQUIRE(report.gaps==expect);
+        BOOST_REQUIRE_EQUAL(report.gaps.at(240), 1);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_CANDLE_VALIDATOR_HPP
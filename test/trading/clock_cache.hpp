@@ -0,0 +1,37 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_CLOCK_CACHE_HPP
+#define BACKTESTING_TEST_CLOCK_CACHE_HPP
+
+#include <string>
+#include <boost/test/unit_test.hpp>
+#include <trading/clock_cache.hpp>
+
+BOOST_AUTO_TEST_SUITE(clock_cache_test)
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW((trading::clock_cache<int, int>{0}), std::invalid_argument);
+        BOOST_REQUIRE_THROW((trading::clock_cache<int, int>{8, 0}), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        trading::clock_cache<int, std::string> cache{2, 1};
+        BOOST_REQUIRE(!cache.find(1));
+        cache.insert(1, "one");
+        cache.insert(2, "two");
+        BOOST_REQUIRE_EQUAL(*cache.find(1), "one");
+
+        // the referenced key gets a second chance
+        cache.insert(3, "three");
+        BOOST_REQUIRE_EQUAL(cache.eviction_count(), 1);
+        BOOST_REQUIRE_EQUAL(cache.size(), 2);
+        BOOST_REQUIRE(cache.find(1));
+        BOOST_REQUIRE(!cache.find(2));
+        BOOST_REQUIRE_EQUAL(*cache.find(3), "three");
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_CLOCK_CACHE_HPP
@@ -75,4 +75,34 @@ BOOST_AUTO_TEST_SUITE(prom_criterion_test)
         BOOST_REQUIRE_CLOSE(criterion(stats), ((18'750.-13'333.)/10'000.)*100, 0.01);
     }
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(phase_criterion_test)
+    BOOST_AUTO_TEST_CASE(summarize_test)
+    {
+        auto summary = trading::summarize({2.0, 4.0, 6.0});
+        BOOST_REQUIRE_CLOSE(summary.mean, 4.0, 1e-9);
+        BOOST_REQUIRE_CLOSE(summary.worst, 2.0, 1e-9);
+        BOOST_REQUIRE_CLOSE(summary.deviation, std::sqrt(8.0/3), 1e-9);
+    }
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        struct value_criterion {
+            double operator()(double val) const
+            {
+                return val;
+            }
+
+            static std::string name()
+            {
+                return "value";
+            }
+        };
+
+        trading::phase_criterion<value_criterion> criterion{{}, 0.5, 1.0};
+        BOOST_REQUIRE_CLOSE(criterion(std::vector<double>{2.0, 4.0, 6.0}), 0.5*4.0+0.5*2.0-std::sqrt(8.0/3), 1e-9);
+        BOOST_REQUIRE_EQUAL(criterion(std::vector<double>{3.0, 3.0}), 3.0);
+        BOOST_REQUIRE_EQUAL(decltype(criterion)::name(), "phase value");
+    }
+BOOST_AUTO_TEST_SUITE_END()
 #endif //BACKTESTING_TEST_CRITERION_HPP
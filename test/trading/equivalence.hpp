@@ -0,0 +1,85 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_EQUIVALENCE_HPP
+#define BACKTESTING_TEST_EQUIVALENCE_HPP
+
+#include <memory>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <trading/equivalence.hpp>
+#include <trading/state.hpp>
+
+BOOST_AUTO_TEST_SUITE(equivalent_objective_test)
+    using state_type = trading::state<int>;
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        std::size_t call_count{0};
+        auto objective = [&](const int& config) {
+            call_count++;
+            return state_type{config, config%10*1.5};
+        };
+        auto key = [](const int& config) { return config%10; };
+        trading::equivalent_objective<state_type, decltype(objective), decltype(key)> equivalent{objective, key, 64, 4};
+
+        for (int config{0}; config<100; config++) {
+            auto state = equivalent(config);
+            BOOST_REQUIRE_EQUAL(state.config, config);
+            BOOST_REQUIRE_EQUAL(state.value, config%10*1.5);
+        }
+        BOOST_REQUIRE_EQUAL(call_count, 10);
+        BOOST_REQUIRE_EQUAL(equivalent.evaluated_count(), 10);
+        BOOST_REQUIRE_EQUAL(equivalent.avoided_count(), 90);
+        BOOST_REQUIRE_EQUAL(equivalent.size(), 10);
+        BOOST_REQUIRE_EQUAL(equivalent.capacity(), 64);
+        BOOST_REQUIRE_EQUAL(equivalent.eviction_count(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(bound_test)
+    {
+        std::size_t call_count{0};
+        auto objective = [&](const int& config) {
+            call_count++;
+            return state_type{config, static_cast<double>(config%10)};
+        };
+        auto key = [](const int& config) { return config%10; };
+        trading::equivalent_objective<state_type, decltype(objective), decltype(key)> equivalent{objective, key, 4, 1};
+
+        // the keys do not fit, so the evicted ones are evaluated again
+        for (int config{0}; config<100; config++)
+            BOOST_REQUIRE_EQUAL(equivalent(config).value, config%10);
+        BOOST_REQUIRE_EQUAL(equivalent.size(), 4);
+        BOOST_REQUIRE_GT(equivalent.eviction_count(), 0);
+        BOOST_REQUIRE_EQUAL(call_count, equivalent.evaluated_count());
+        BOOST_REQUIRE_EQUAL(equivalent.evaluated_count()+equivalent.avoided_count(), 100);
+        BOOST_REQUIRE_GT(equivalent.evaluated_count(), 10);
+    }
+
+    struct dummy_optimizer {
+        std::size_t it() const
+        {
+            return 3;
+        }
+    };
+
+    BOOST_AUTO_TEST_CASE(reporter_test)
+    {
+        auto objective = [](const int& config) { return state_type{config, 1.0}; };
+        auto key = [](const int& config) { return config%2; };
+        using equivalent_t = trading::equivalent_objective<state_type, decltype(objective), decltype(key)>;
+        equivalent_t equivalent{objective, key, 16};
+        for (int config{0}; config<5; config++)
+            equivalent(config);
+
+        auto logger = std::make_shared<std::ostringstream>();
+        trading::equivalence_reporter<equivalent_t, std::ostringstream> reporter{equivalent, logger};
+        reporter.started(dummy_optimizer{});
+        BOOST_REQUIRE(logger->str().empty());
+        reporter.iteration_passed(dummy_optimizer{});
+        BOOST_REQUIRE(logger->str().find("it: 3, evaluations avoided: 3, evaluated: 2")!=std::string::npos);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_EQUIVALENCE_HPP
@@ -0,0 +1,102 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_EVALUATION_CACHE_HPP
+#define BACKTESTING_TEST_EVALUATION_CACHE_HPP
+
+#include <atomic>
+#include <boost/test/unit_test.hpp>
+#include <trading/evaluation_cache.hpp>
+#include <trading/state.hpp>
+
+BOOST_AUTO_TEST_SUITE(evaluation_cache_test)
+    using state_type = trading::state<int>;
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        std::size_t call_count{0};
+        auto objective = [&](const int& config) {
+            call_count++;
+            return state_type{config, config*1.5};
+        };
+        trading::evaluation_cache<state_type, decltype(objective)> cache{objective, 64, 4};
+        BOOST_REQUIRE_EQUAL(cache.capacity(), 64);
+        BOOST_REQUIRE_EQUAL(cache.shard_count(), 4);
+        BOOST_REQUIRE_EQUAL(cache.hit_ratio(), 0.0);
+
+        for (int rep{0}; rep<4; rep++)
+            for (int config{0}; config<10; config++) {
+                auto state = cache(config);
+                BOOST_REQUIRE_EQUAL(state.config, config);
+                BOOST_REQUIRE_EQUAL(state.value, config*1.5);
+            }
+        BOOST_REQUIRE_EQUAL(call_count, 10);
+        BOOST_REQUIRE_EQUAL(cache.miss_count(), 10);
+        BOOST_REQUIRE_EQUAL(cache.hit_count(), 30);
+        BOOST_REQUIRE_EQUAL(cache.hit_ratio(), 0.75);
+        BOOST_REQUIRE_EQUAL(cache.size(), 10);
+        BOOST_REQUIRE_EQUAL(cache.eviction_count(), 0);
+        BOOST_REQUIRE(cache.memory()>10*sizeof(state_type));
+    }
+
+    BOOST_AUTO_TEST_CASE(eviction_test)
+    {
+        std::size_t call_count{0};
+        auto objective = [&](const int& config) {
+            call_count++;
+            return state_type{config, static_cast<double>(config)};
+        };
+        trading::evaluation_cache<state_type, decltype(objective)> cache{objective, 2, 1};
+        cache(1);
+        cache(2);
+        cache(1);
+
+        // the referenced configuration gets a second chance
+        cache(3);
+        BOOST_REQUIRE_EQUAL(cache.eviction_count(), 1);
+        BOOST_REQUIRE_EQUAL(cache.size(), 2);
+        BOOST_REQUIRE_EQUAL(call_count, 3);
+        cache(1);
+        BOOST_REQUIRE_EQUAL(call_count, 3);
+        cache(2);
+        BOOST_REQUIRE_EQUAL(call_count, 4);
+
+        for (int config{0}; config<100; config++)
+            cache(config);
+        BOOST_REQUIRE_EQUAL(cache.size(), cache.capacity());
+    }
+
+    BOOST_AUTO_TEST_CASE(concurrent_test)
+    {
+        std::atomic<std::size_t> call_count{0};
+        auto objective = [&](const int& config) {
+            call_count++;
+            return state_type{config, static_cast<double>(config)};
+        };
+        trading::evaluation_cache<state_type, decltype(objective)> cache{objective, 1'000, 8};
+        const int config_count{100}, total{10'000};
+        std::atomic<std::size_t> mismatch_count{0};
+
+        #pragma omp parallel for num_threads(4)
+        for (int i = 0; i<total; i++)
+            if (cache(i%config_count).config!=i%config_count)
+                mismatch_count++;
+
+        BOOST_REQUIRE_EQUAL(mismatch_count, 0);
+        BOOST_REQUIRE_EQUAL(cache.hit_count()+cache.miss_count(), total);
+        BOOST_REQUIRE_EQUAL(cache.miss_count(), call_count);
+        BOOST_REQUIRE(call_count>=config_count);
+        BOOST_REQUIRE_EQUAL(cache.size(), config_count);
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        auto objective = [](const int& config) { return state_type{config, 0.0}; };
+        using cache_type = trading::evaluation_cache<state_type, decltype(objective)>;
+        BOOST_REQUIRE_THROW(cache_type(objective, 0), std::invalid_argument);
+        BOOST_REQUIRE_THROW(cache_type(objective, 10, 0), std::invalid_argument);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_EVALUATION_CACHE_HPP
@@ -0,0 +1,64 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_GENETIC_ALGORITHM_ARENA_HPP
+#define BACKTESTING_TEST_GENETIC_ALGORITHM_ARENA_HPP
+
+#include <boost/test/unit_test.hpp>
+#include <vector>
+#include <algorithm>
+#include <trading/state.hpp>
+#include <trading/genetic_algorithm/arena.hpp>
+
+BOOST_AUTO_TEST_SUITE(genetic_algorithm_arena_test)
+    using state_t = trading::state<int>;
+    using arena_t = trading::genetic_algorithm::arena<state_t>;
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        arena_t arena;
+        std::vector<std::size_t> population, children;
+        arena.acquire(4, population);
+        for (std::size_t i{0}; i<population.size(); i++)
+            arena.assign(population[i], state_t{static_cast<int>(i), i*10.0});
+        BOOST_REQUIRE_EQUAL(arena.size(), 4);
+
+        for (std::size_t i{0}; i<population.size(); i++) {
+            BOOST_REQUIRE_EQUAL(arena.config(population[i]), i);
+            BOOST_REQUIRE_EQUAL(arena.value(population[i]), i*10.0);
+            BOOST_REQUIRE_EQUAL(arena.state(population[i]).config, i);
+        }
+
+        // the released slots are reused by the next individuals
+        std::vector<std::size_t> kept{population[1], population[3]};
+        arena.keep(kept);
+        BOOST_REQUIRE_EQUAL(arena.size(), 2);
+        arena.acquire(3, children);
+        BOOST_REQUIRE_EQUAL(arena.size(), 5);
+        BOOST_REQUIRE_EQUAL(arena.slot_count(), 5);
+        for (auto index: children)
+            BOOST_REQUIRE(std::find(kept.begin(), kept.end(), index)==kept.end());
+        BOOST_REQUIRE_EQUAL(arena.state(kept[0]).config, 1);
+        BOOST_REQUIRE_EQUAL(arena.state(kept[1]).config, 3);
+
+        arena.clear();
+        BOOST_REQUIRE_EQUAL(arena.size(), 0);
+        BOOST_REQUIRE_EQUAL(arena.slot_count(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(index_comparator_test)
+    {
+        arena_t arena;
+        std::vector<std::size_t> population;
+        arena.acquire(2, population);
+        arena.assign(population[0], state_t{1, 1.0});
+        arena.assign(population[1], state_t{2, 2.0});
+        auto greater = [](const state_t& lhs, const state_t& rhs) { return lhs.value>rhs.value; };
+        trading::genetic_algorithm::index_comparator<state_t, decltype(greater)> comp{arena, greater};
+        BOOST_REQUIRE(comp(population[1], population[0]));
+        BOOST_REQUIRE(!comp(population[0], population[1]));
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_GENETIC_ALGORITHM_ARENA_HPP
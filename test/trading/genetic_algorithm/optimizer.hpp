@@ -8,6 +8,9 @@
 #include <boost/test/unit_test.hpp>
 #include <vector>
 #include <array>
+#include <cmath>
+#include <random>
+#include <numeric>
 #include <trading/genetic_algorithm/optimizer.hpp>
 #include <trading/genetic_algorithm/matchmaker.hpp>
 #include <trading/genetic_algorithm/replacement.hpp>
@@ -93,6 +96,85 @@ BOOST_AUTO_TEST_SUITE(genetic_algorithm_optimizer_test)
         BOOST_REQUIRE_EQUAL(counter.finished_count, 1);
         BOOST_REQUIRE_EQUAL(counter.population_updated_count, termination.max_it());
     }
+
+    struct pair_matchmaker {
+        constexpr static std::size_t n_parents = 2;
+
+        cppcoro::generator<std::array<std::size_t, n_parents>> operator()(const std::vector<std::size_t>& parents)
+        {
+            for (std::size_t i{1}; i<parents.size(); i += 2)
+                co_yield std::array<std::size_t, n_parents>{parents[i-1], parents[i]};
+        }
+    };
+
+    struct pair_crossover {
+        constexpr static std::size_t n_children = 2, n_parents = 2;
+
+        std::array<config_type, n_children> operator()(const std::array<config_type, n_parents>& parents)
+        {
+            return {(parents[0]+parents[1])/2, (parents[0]+3*parents[1])/4};
+        }
+    };
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(optimizer_type{0}, std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(thread_count_test)
+    {
+        // the fittest half of the population mates in pairs
+        auto selection = [](std::size_t size, const std::vector<double>& fitness, std::vector<std::size_t>& parents) {
+            parents.resize(fitness.size());
+            std::iota(parents.begin(), parents.end(), 0);
+            std::stable_sort(parents.begin(), parents.end(), [&](std::size_t lhs, std::size_t rhs) {
+                return fitness[lhs]>fitness[rhs];
+            });
+            parents.resize(std::min(size, parents.size()));
+        };
+        auto fitness = [](const config_type& config) {
+            double value{0};
+            for (int i{1}; i<=1'000; i++)
+                value += std::sin(config*0.001*i)/i;
+            return state_t{config, value};
+        };
+
+        auto run = [&](std::size_t thread_count) {
+            std::mt19937 gen{42};
+            std::uniform_int_distribution distrib{-500, 500};
+            std::vector<config_type> init_genes;
+            for (std::size_t i{0}; i<64; i++)
+                init_genes.emplace_back(distrib(gen)*20);
+
+            trading::constructive_result result{fitness(0), [](const state_t& lhs, const state_t& rhs) {
+                return lhs.value>rhs.value;
+            }};
+            auto mutation = [&](config_type&& child) -> config_type { return child+distrib(gen); };
+            auto replacement = [](const std::vector<std::size_t>& parents, const std::vector<std::size_t>& children,
+                    auto&&, std::vector<std::size_t>& population) {
+                population = parents;
+                population.insert(population.end(), children.begin(), children.end());
+            };
+            optimizer_type optimizer{thread_count};
+            optimizer(init_genes, result, [](const auto&) { return true; }, fitness,
+                    [](std::size_t) { return std::size_t{32}; }, selection, pair_matchmaker{}, pair_crossover{},
+                    mutation, replacement,
+                    trading::iteration_based_termination{20});
+            auto population = optimizer.population();
+            return std::make_pair(std::vector<state_t>(population.begin(), population.end()), result.get());
+        };
+
+        auto [expect_population, expect_best] = run(1);
+        for (std::size_t thread_count: {2, 4, 7}) {
+            auto [population, best] = run(thread_count);
+            BOOST_REQUIRE_EQUAL(population.size(), expect_population.size());
+            for (std::size_t i{0}; i<population.size(); i++) {
+                BOOST_REQUIRE_EQUAL(population[i].config, expect_population[i].config);
+                BOOST_REQUIRE_EQUAL(population[i].value, expect_population[i].value);
+            }
+            BOOST_REQUIRE_EQUAL(best.config, expect_best.config);
+        }
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_GENETIC_ALGORITHM_OPTIMIZER_HPP
@@ -7,6 +7,8 @@
 
 #include <boost/test/unit_test.hpp>
 #include <vector>
+#include <algorithm>
+#include <functional>
 #include <trading/genetic_algorithm/replacement.hpp>
 
 BOOST_AUTO_TEST_SUITE(genetic_algorithm_en_block_replacement_test)
@@ -16,4 +18,18 @@ BOOST_AUTO_TEST_SUITE(genetic_algorithm_en_block_replacement_test)
     }
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(genetic_algorithm_elitism_replacement_test)
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        // the indices are their own fitness
+        std::vector<std::size_t> parents{3, 9, 1, 7, 5, 8, 0, 2, 6, 4}, children{10, 11}, next_generation;
+        trading::genetic_algorithm::elitism_replacement replacement{{3, 10}};
+        replacement(parents, children, std::greater<std::size_t>{}, next_generation);
+
+        BOOST_REQUIRE_EQUAL(next_generation.size(), 5);
+        std::sort(next_generation.begin(), next_generation.begin()+3);
+        BOOST_REQUIRE((std::vector<std::size_t>{7, 8, 9, 10, 11})==next_generation);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
 #endif //BACKTESTING_TEST_GENETIC_ALGORITHM_REPLACEMENT_HPP
@@ -14,21 +14,19 @@
 BOOST_AUTO_TEST_SUITE(genetic_algorithm_roulette_selection_test)
     void test_usage(std::size_t select_n, std::size_t population_size)
     {
-        using config_type = int;
-        using state_type = trading::state<config_type>;
-        std::vector<state_type> population, parents;
-        auto objective = [](const auto& config) { return static_cast<double>(config); };
-        population.reserve(population_size);
-        auto generator = trading::random::int_interval_generator<config_type>{1, 100};
-
-        for (std::size_t i{0}; i<population_size; i++) {
-            config_type individual = generator();
-            population.emplace_back(state_type{individual, objective(individual)});
-        }
+        std::vector<double> fitness;
+        std::vector<std::size_t> parents;
+        fitness.reserve(population_size);
+        auto generator = trading::random::int_interval_generator<int>{1, 100};
+
+        for (std::size_t i{0}; i<population_size; i++)
+            fitness.emplace_back(generator());
 
         trading::genetic_algorithm::roulette_selection selection{};
-        selection(select_n, population, parents);
+        selection(select_n, fitness, parents);
         BOOST_REQUIRE_EQUAL(select_n, parents.size());
+        for (auto position: parents)
+            BOOST_REQUIRE_LT(position, population_size);
     }
 
     BOOST_AUTO_TEST_CASE(usage_test)
@@ -37,6 +35,17 @@ BOOST_AUTO_TEST_SUITE(genetic_algorithm_roulette_selection_test)
         test_usage(0, 100);
         test_usage(0, 1);
     }
+
+    BOOST_AUTO_TEST_CASE(negative_fitness_test)
+    {
+        // shifted by the minimum, so the least fit individual is never selected
+        std::vector<double> fitness{-10.0, -5.0, 0.0, 5.0};
+        std::vector<std::size_t> parents;
+        trading::genetic_algorithm::roulette_selection selection{trading::random::engine{3}};
+        selection(1'000, fitness, parents);
+        BOOST_REQUIRE_EQUAL(parents.size(), 1'000);
+        BOOST_REQUIRE(std::find(parents.begin(), parents.end(), 0)==parents.end());
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_GENETIC_ALGORITHM_SELECTION_HPP
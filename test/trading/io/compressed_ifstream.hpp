@@ -0,0 +1,108 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_IO_COMPRESSED_IFSTREAM_HPP
+#define BACKTESTING_TEST_IO_COMPRESSED_IFSTREAM_HPP
+
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <boost/test/unit_test.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
+#include <trading/io/compressed_ifstream.hpp>
+#include <trading/io/csv/reader.hpp>
+
+BOOST_AUTO_TEST_SUITE(io_compressed_ifstream_test)
+    template<class Compressor>
+    void write_compressed(const std::filesystem::path& path, const std::string& content)
+    {
+        std::ofstream file{path, std::ios::binary};
+        boost::iostreams::filtering_ostream out;
+        out.push(Compressor{});
+        out.push(file);
+        out << content;
+    }
+
+    std::string sample_rows()
+    {
+        std::string content{"opened,close\n"};
+        for (int i{0}; i<50'000; i++)
+            content += std::to_string(i*60)+','+std::to_string(100+i%13)+'\n';
+        return content;
+    }
+
+    void check_rows(const std::filesystem::path& path)
+    {
+        trading::io::csv::reader<2, trading::io::compressed_ifstream> reader{path};
+        std::array<std::string, 2> header;
+        BOOST_REQUIRE(reader.read_header(header));
+        BOOST_REQUIRE_EQUAL(header[1], "close");
+
+        long opened, close, count{0};
+        while (reader.read_row(opened, close)) {
+            BOOST_REQUIRE_EQUAL(opened, count*60);
+            BOOST_REQUIRE_EQUAL(close, 100+count%13);
+            count++;
+        }
+        BOOST_REQUIRE_EQUAL(count, 50'000);
+    }
+
+    BOOST_AUTO_TEST_CASE(compression_of_test)
+    {
+        BOOST_REQUIRE(trading::io::compression_of("candles.csv.gz")==trading::io::compression::gzip);
+        BOOST_REQUIRE(trading::io::compression_of("candles.csv.zst")==trading::io::compression::zstd);
+        BOOST_REQUIRE(trading::io::compression_of("candles.csv")==trading::io::compression::none);
+    }
+
+    BOOST_AUTO_TEST_CASE(read_test)
+    {
+        auto dir = std::filesystem::temp_directory_path();
+        auto content = sample_rows();
+        std::ofstream{dir/"backtesting-rows.csv"} << content;
+        write_compressed<boost::iostreams::gzip_compressor>(dir/"backtesting-rows.csv.gz", content);
+        write_compressed<boost::iostreams::zstd_compressor>(dir/"backtesting-rows.csv.zst", content);
+
+        for (const auto& name: {"backtesting-rows.csv", "backtesting-rows.csv.gz", "backtesting-rows.csv.zst"}) {
+            check_rows(dir/name);
+            std::filesystem::remove(dir/name);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(plain_test)
+    {
+        // plain files bypass the decompressing thread
+        auto dir = std::filesystem::temp_directory_path();
+        std::ofstream{dir/"backtesting-plain.csv"} << "opened,close\n0,100\n";
+        write_compressed<boost::iostreams::gzip_compressor>(dir/"backtesting-plain.csv.gz", "opened,close\n");
+
+        trading::io::compressed_ifstream plain{dir/"backtesting-plain.csv"};
+        BOOST_REQUIRE(plain.is_open());
+        BOOST_REQUIRE(!plain.decompressing());
+        trading::io::compressed_ifstream compressed{dir/"backtesting-plain.csv.gz"};
+        BOOST_REQUIRE(compressed.is_open());
+        BOOST_REQUIRE(compressed.decompressing());
+
+        trading::io::compressed_ifstream missing{dir/"backtesting-missing.csv"};
+        BOOST_REQUIRE(!missing.is_open());
+        BOOST_REQUIRE(missing.fail());
+
+        std::filesystem::remove(dir/"backtesting-plain.csv");
+        std::filesystem::remove(dir/"backtesting-plain.csv.gz");
+    }
+
+    BOOST_AUTO_TEST_CASE(corrupted_test)
+    {
+        auto path = std::filesystem::temp_directory_path()/"backtesting-corrupted.csv.gz";
+        std::ofstream{path} << "definitely not gzip\n";
+        trading::io::compressed_ifstream in{path};
+        BOOST_REQUIRE(in.is_open());
+        std::string line;
+        BOOST_REQUIRE_THROW(std::getline(in, line), std::exception);
+        std::filesystem::remove(path);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_IO_COMPRESSED_IFSTREAM_HPP
@@ -0,0 +1,65 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_IO_CSV_TICK_READER_HPP
+#define BACKTESTING_TEST_IO_CSV_TICK_READER_HPP
+
+#include <fstream>
+#include <filesystem>
+#include <boost/test/unit_test.hpp>
+#include <trading/io/csv/tick_reader.hpp>
+
+BOOST_AUTO_TEST_SUITE(io_csv_tick_reader_test)
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(trading::io::csv::tick_reader{"does-not-exist.csv"}, std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(read_test)
+    {
+        auto path = std::filesystem::temp_directory_path()/"backtesting-ticks.csv";
+        {
+            std::ofstream out{path};
+            out << "time,price,quantity\n";
+            for (int i{0}; i<1'000; i++)
+                out << 1'000'000+i*1'500 << ',' << 100+i%7 << ".25," << i%3 << ".5\r\n";
+            out << "2500000,99.5,1";    // without the new line
+        }
+
+        // the small blocks split the lines
+        trading::io::csv::tick_reader reader{path, ',', true, 1'000, 64};
+        trading::tick_columns ticks, all;
+        while (reader.read(ticks))
+            for (std::size_t i{0}; i<ticks.size(); i++)
+                all.emplace_back(ticks.time[i], ticks.price[i], ticks.quantity[i]);
+
+        BOOST_REQUIRE_EQUAL(all.size(), 1'001);
+        for (int i{0}; i<1'000; i++) {
+            BOOST_REQUIRE_EQUAL(all.time[i], (1'000'000+i*1'500)/1'000);
+            BOOST_REQUIRE_EQUAL(all.price[i], 100+i%7+0.25f);
+            BOOST_REQUIRE_EQUAL(all.quantity[i], i%3+0.5f);
+        }
+        BOOST_REQUIRE_EQUAL(all.time.back(), 2'500);
+        BOOST_REQUIRE_EQUAL(all.price.back(), 99.5f);
+
+        trading::io::csv::tick_reader whole{path, ',', true, 1'000};
+        trading::tick_aggregator aggregator{60};
+        auto candles = trading::io::csv::aggregate_ticks(whole, aggregator);
+        BOOST_REQUIRE_EQUAL(candles.opened.front(), 960);
+        BOOST_REQUIRE_EQUAL(candles.opened.back(), 2'460);
+        std::filesystem::remove(path);
+    }
+
+    BOOST_AUTO_TEST_CASE(parse_exception_test)
+    {
+        auto path = std::filesystem::temp_directory_path()/"backtesting-invalid-ticks.csv";
+        std::ofstream{path} << "1,2\n";
+        trading::io::csv::tick_reader reader{path};
+        trading::tick_columns ticks;
+        BOOST_REQUIRE_THROW(reader.read(ticks), std::runtime_error);
+        std::filesystem::remove(path);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_IO_CSV_TICK_READER_HPP
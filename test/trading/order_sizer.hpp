@@ -56,6 +56,12 @@ BOOST_AUTO_TEST_SUITE(sizer_test)
         // small balance
         check_sizing(std::array<fraction_t, 4>{{{1, 8}, {2, 8}, {2, 8}, {3, 8}}}, 0.00000001/3);
     }
+
+    BOOST_AUTO_TEST_CASE(cumulative_sizes_test)
+    {
+        order_sizer sizer{std::array<fraction_t, 3>{{{2, 4}, {1, 4}, {1, 4}}}};
+        BOOST_REQUIRE((sizer.cumulative_sizes()==std::array<double, 3>{0.5, 0.5, 1.0}));
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_ORDER_SIZER_HPP
@@ -0,0 +1,117 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_PAPER_FEED_HPP
+#define BACKTESTING_TEST_PAPER_FEED_HPP
+
+#include <thread>
+#include <fstream>
+#include <filesystem>
+#include <boost/test/unit_test.hpp>
+#include <trading/paper/feed.hpp>
+
+BOOST_AUTO_TEST_SUITE(paper_feed_test)
+    std::vector<trading::candle> feed_candles()
+    {
+        return {trading::candle{0, 10, 12, 9, 11}, trading::candle{60, 11, 11.5, 10, 10.5},
+                trading::candle{120, 10.5, 13, 10.25, 12.75}};
+    }
+
+    std::filesystem::path feed_path(const std::string& name)
+    {
+        auto path = std::filesystem::temp_directory_path()/name;
+        std::filesystem::remove(path);
+        return path;
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(trading::paper::csv_feed{"does-not-exist.csv"}, std::invalid_argument);
+        BOOST_REQUIRE_THROW(trading::paper::binary_feed{"does-not-exist.bin"}, std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(csv_feed_test)
+    {
+        auto path = feed_path("backtesting-feed.csv");
+        std::ofstream{path} << "opened,open,high,low,close\n";
+        trading::paper::csv_feed feed{path, ',', true};
+        BOOST_REQUIRE(!feed.next());
+
+        auto candles = feed_candles();
+        trading::paper::csv_feed_writer writer{path};
+        writer(candles[0]);
+        writer(candles[1]);
+        BOOST_REQUIRE(*feed.next()==candles[0]);
+        BOOST_REQUIRE(*feed.next()==candles[1]);
+        BOOST_REQUIRE(!feed.next());
+
+        // the partially written line is read once complete
+        std::ofstream out{path, std::ios::app};
+        out << "120,10.5,13," << std::flush;
+        BOOST_REQUIRE(!feed.next());
+        out << "10.25,12.75\n" << std::flush;
+        BOOST_REQUIRE(*feed.next()==candles[2]);
+        BOOST_REQUIRE(!feed.exhausted());
+        std::filesystem::remove(path);
+    }
+
+    BOOST_AUTO_TEST_CASE(binary_feed_test)
+    {
+        auto path = feed_path("backtesting-feed.bin");
+        std::ofstream out{path, std::ios::binary};
+        trading::paper::binary_feed feed{path};
+        BOOST_REQUIRE(!feed.next());
+
+        // the partially written record is read once complete
+        auto candles = feed_candles();
+        auto record = trading::paper::to_record(candles[0]);
+        out.write(reinterpret_cast<const char*>(&record), 10).flush();
+        BOOST_REQUIRE(!feed.next());
+        out.write(reinterpret_cast<const char*>(&record)+10, sizeof(record)-10).flush();
+        BOOST_REQUIRE(*feed.next()==candles[0]);
+
+        trading::paper::binary_feed_writer writer{path};
+        writer(candles[1]);
+        writer(candles[2]);
+        BOOST_REQUIRE(*feed.next()==candles[1]);
+        BOOST_REQUIRE(*feed.next()==candles[2]);
+        BOOST_REQUIRE(!feed.next());
+        std::filesystem::remove(path);
+    }
+
+    BOOST_AUTO_TEST_CASE(socket_feed_test)
+    {
+        auto path = feed_path("backtesting-feed.sock");
+        auto candles = feed_candles();
+        trading::paper::socket_feed feed{path};
+        BOOST_REQUIRE(!feed.next());
+
+        std::jthread producer{[&] {
+            trading::paper::socket_feed_writer writer{path};
+            trading::paper::replay(candles, writer, std::chrono::microseconds{100});
+        }};
+
+        std::vector<trading::candle> received;
+        while (!feed.exhausted())
+            if (auto curr = feed.next())
+                received.emplace_back(*curr);
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds{10});
+        BOOST_REQUIRE(received==candles);
+    }
+
+    BOOST_AUTO_TEST_CASE(memory_feed_test)
+    {
+        auto candles = feed_candles();
+        trading::paper::memory_feed feed{candles};
+        for (const auto& candle: candles) {
+            BOOST_REQUIRE(!feed.exhausted());
+            BOOST_REQUIRE(*feed.next()==candle);
+        }
+        BOOST_REQUIRE(feed.exhausted());
+        BOOST_REQUIRE(!feed.next());
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_PAPER_FEED_HPP
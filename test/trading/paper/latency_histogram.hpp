@@ -0,0 +1,54 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_PAPER_LATENCY_HISTOGRAM_HPP
+#define BACKTESTING_TEST_PAPER_LATENCY_HISTOGRAM_HPP
+
+#include <chrono>
+#include <boost/test/unit_test.hpp>
+#include <trading/paper/latency_histogram.hpp>
+
+BOOST_AUTO_TEST_SUITE(paper_latency_histogram_test)
+    BOOST_AUTO_TEST_CASE(percentile_exception_test)
+    {
+        trading::paper::latency_histogram histogram;
+        BOOST_REQUIRE_THROW(histogram.percentile(-0.1), std::invalid_argument);
+        BOOST_REQUIRE_THROW(histogram.percentile(1.1), std::invalid_argument);
+        BOOST_REQUIRE_EQUAL(histogram.percentile(0.5).count(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(percentile_test)
+    {
+        trading::paper::latency_histogram histogram;
+        for (std::int64_t i{1}; i<=100'000; i++)
+            histogram.record(std::chrono::nanoseconds{i});
+
+        BOOST_REQUIRE_EQUAL(histogram.count(), 100'000);
+        BOOST_REQUIRE_EQUAL(histogram.min().count(), 1);
+        BOOST_REQUIRE_EQUAL(histogram.max().count(), 100'000);
+        BOOST_REQUIRE_EQUAL(histogram.percentile(1.0).count(), 100'000);
+        BOOST_REQUIRE_CLOSE(static_cast<double>(histogram.percentile(0.5).count()), 50'000.0, 3.2);
+        BOOST_REQUIRE_CLOSE(static_cast<double>(histogram.percentile(0.99).count()), 99'000.0, 3.2);
+        BOOST_REQUIRE(histogram.percentile(0.5)>=std::chrono::nanoseconds{50'000});
+
+        // exact below the linear range
+        trading::paper::latency_histogram small;
+        for (std::int64_t i{0}; i<50; i++)
+            small.record(std::chrono::nanoseconds{i});
+        BOOST_REQUIRE_EQUAL(small.percentile(0.5).count(), 24);
+    }
+
+    BOOST_AUTO_TEST_CASE(merge_test)
+    {
+        trading::paper::latency_histogram lhs, rhs;
+        lhs.record(std::chrono::microseconds{3});
+        rhs.record(std::chrono::milliseconds{2});
+        lhs.merge(rhs);
+        BOOST_REQUIRE_EQUAL(lhs.count(), 2);
+        BOOST_REQUIRE_EQUAL(lhs.min().count(), 3'000);
+        BOOST_REQUIRE_EQUAL(lhs.max().count(), 2'000'000);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_PAPER_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,49 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_PAPER_LOG_SINK_HPP
+#define BACKTESTING_TEST_PAPER_LOG_SINK_HPP
+
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <trading/paper/log_sink.hpp>
+
+BOOST_AUTO_TEST_SUITE(paper_log_sink_test)
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        std::ostringstream out;
+        BOOST_REQUIRE_THROW(trading::paper::log_sink<int>(out, 0), std::invalid_argument);
+        BOOST_REQUIRE_THROW(trading::paper::log_sink<int>(out, 100), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(write_test)
+    {
+        std::ostringstream out;
+        {
+            trading::paper::log_sink<int> sink{out, 1<<10, std::chrono::microseconds{10}};
+            for (int i{0}; i<5; i++)
+                BOOST_REQUIRE(sink.push(i));
+            sink.close();
+            BOOST_REQUIRE_EQUAL(sink.written_count(), 5);
+            BOOST_REQUIRE_EQUAL(sink.dropped_count(), 0);
+        }
+        BOOST_REQUIRE_EQUAL(out.str(), "0\n1\n2\n3\n4\n");
+    }
+
+    BOOST_AUTO_TEST_CASE(drop_test)
+    {
+        std::ostringstream out;
+        trading::paper::log_sink<int> sink{out, 4, std::chrono::seconds{10}};
+        std::size_t pushed{0};
+        for (int i{0}; i<100; i++)
+            pushed += sink.push(i);
+        sink.close();
+
+        BOOST_REQUIRE_EQUAL(pushed+sink.dropped_count(), 100);
+        BOOST_REQUIRE_EQUAL(sink.written_count(), pushed);
+        BOOST_REQUIRE(sink.dropped_count()>0);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_PAPER_LOG_SINK_HPP
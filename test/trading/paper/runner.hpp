@@ -0,0 +1,93 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_PAPER_RUNNER_HPP
+#define BACKTESTING_TEST_PAPER_RUNNER_HPP
+
+#include <cmath>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <trading/paper/runner.hpp>
+#include <trading/paper/feed.hpp>
+#include <trading/bazooka/strategy.hpp>
+#include <trading/bazooka/trader.hpp>
+#include <trading/bazooka/manager.hpp>
+#include <trading/simulator.hpp>
+
+BOOST_AUTO_TEST_SUITE(paper_runner_test)
+    constexpr std::size_t n_levels{3};
+
+    struct decision_collector {
+        std::vector<std::pair<std::time_t, trading::action>> decisions;
+
+        template<class Trader>
+        void started(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void decided(const Trader&, trading::action done, const trading::price_point& point)
+        {
+            if (done!=trading::action::none) decisions.emplace_back(point.time, done);
+        }
+
+        template<class Trader>
+        void position_active(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void indicators_updated(const Trader&, const trading::price_point&) { }
+
+        template<class Trader>
+        void finished(const Trader&, const trading::price_point&) { }
+    };
+
+    BOOST_AUTO_TEST_CASE(equivalence_test)
+    {
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<2'000; i++) {
+            if (i%277==13) continue;
+            auto close = static_cast<trading::price_t>(100.0+15.0*std::sin(i/47.0)+5.0*std::sin(i/5.0));
+            candles.emplace_back(trading::candle{i*60, close, close+1, close-1, close});
+        }
+
+        trading::fraction_t fee{1, 100};
+        trading::market market{trading::wallet{10'000}, fee, fee};
+        trading::time_resampler resampler{180, 60};
+        trading::amount_t min_equity{1'000};
+        std::array<trading::fraction_t, n_levels> levels{{{99, 100}, {97, 100}, {94, 100}}};
+        std::array<trading::fraction_t, n_levels> sizes{{{1, 3}, {1, 3}, {1, 3}}};
+        trading::bazooka::indicator indic{trading::ema{9}};
+        trading::bazooka::trader trader{trading::bazooka::strategy{indic, indic, levels},
+                                        trading::bazooka::manager{market, trading::order_sizer{sizes}}};
+
+        trading::simulator simulator{candles, resampler, trading::candle::ohlc4{}, min_equity};
+        auto simulated = trader;
+        decision_collector collector;
+        simulator(simulated, collector);
+        BOOST_REQUIRE(collector.decisions.size()>10);
+
+        std::ostringstream log;
+        trading::paper::log_sink<trading::paper::decision_record> sink{log, 1<<10, std::chrono::microseconds{10}};
+        trading::paper::runner runner{trader, resampler, sink, min_equity};
+        trading::paper::memory_feed feed{candles};
+        runner.run(feed, std::stop_token{});
+        sink.close();
+
+        BOOST_REQUIRE(!runner.stopped());
+        BOOST_REQUIRE_EQUAL(runner.histogram().count(), candles.size());
+        BOOST_REQUIRE(runner.histogram().percentile(0.5)<=runner.histogram().percentile(0.99));
+        BOOST_REQUIRE(runner.histogram().percentile(0.99)<=runner.histogram().max());
+        BOOST_REQUIRE_EQUAL(runner.trader().wallet_balance(), simulated.wallet_balance());
+        BOOST_REQUIRE_EQUAL(runner.trader().next_entry_level(), simulated.next_entry_level());
+
+        BOOST_REQUIRE_EQUAL(sink.written_count(), collector.decisions.size());
+        std::istringstream lines{log.str()};
+        std::string line;
+        for (const auto& [time, done]: collector.decisions) {
+            BOOST_REQUIRE(std::getline(lines, line));
+            auto expect = std::to_string(time)+(done==trading::action::opened ? ",open," : ",close all,");
+            BOOST_REQUIRE_EQUAL(line.substr(0, expect.size()), expect);
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_PAPER_RUNNER_HPP
@@ -0,0 +1,188 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_PHASE_SIMULATOR_HPP
+#define BACKTESTING_TEST_PHASE_SIMULATOR_HPP
+
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <trading/phase_simulator.hpp>
+#include <trading/simulator.hpp>
+#include <trading/time_resampler.hpp>
+#include <trading/action.hpp>
+#include "fixtures.hpp"
+
+BOOST_AUTO_TEST_SUITE(phase_simulator_test)
+    class recording_trader {
+        amount_t equity_value_;
+
+    public:
+        std::vector<std::pair<trading::index_t, price_t>> updates;
+        trading::index_t tick{0};
+
+        explicit recording_trader(amount_t equity_value)
+                :equity_value_(equity_value) { }
+
+        bool position_active() const
+        {
+            return false;
+        }
+
+        trading::action operator()(const price_point&)
+        {
+            tick++;
+            return trading::action::none;
+        }
+
+        bool update_indicators(price_t price)
+        {
+            updates.emplace_back(tick-1, price);
+            return true;
+        }
+
+        amount_t equity(const price_t&) const
+        {
+            return equity_value_;
+        }
+    };
+
+    struct mock_observer {
+        std::size_t decided_count{0}, finished_count{0};
+
+        template<class Trader>
+        void started(const Trader&, const price_point&) { }
+
+        template<class Trader>
+        void decided(const Trader&, trading::action, const price_point&)
+        {
+            decided_count++;
+        }
+
+        template<class Trader>
+        void position_active(const Trader&, const price_point&) { }
+
+        template<class Trader>
+        void indicators_updated(const Trader&, const price_point&) { }
+
+        template<class Trader>
+        void finished(const Trader&, const price_point&)
+        {
+            finished_count++;
+        }
+    };
+
+    std::vector<trading::candle> phase_candles()
+    {
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<12; i++) {
+            if (i==5) continue;
+            price_t price = 100+static_cast<price_t>(i);
+            candles.emplace_back(trading::candle{i*60, price, price+2, price-2, price+1});
+        }
+        return candles;
+    }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(trading::phase_simulator(phase_candles(), 180, 60, {}, trading::candle::ohlc4{}, 0),
+                std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(all_offsets_test)
+    {
+        auto offsets = trading::phase_simulator::all_offsets(180, 60);
+        std::vector<std::time_t> expect{0, 60, 120};
+        BOOST_REQUIRE_EQUAL_COLLECTIONS(offsets.begin(), offsets.end(), expect.begin(), expect.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(equivalence_test)
+    {
+        auto candles = phase_candles();
+        auto averager = trading::candle::ohlc4{};
+        amount_t min_equity{300};
+        auto offsets = trading::phase_simulator::all_offsets(180, 60);
+        trading::phase_simulator phases{candles, 180, 60, offsets, averager, min_equity};
+        BOOST_REQUIRE_EQUAL(phases.phase_count(), offsets.size());
+
+        std::vector<recording_trader> traders(offsets.size(), recording_trader{min_equity+1});
+        std::vector<mock_observer> observers(offsets.size());
+        phases(traders, observers);
+
+        for (std::size_t p{0}; p<offsets.size(); p++) {
+            trading::simulator simulator{candles, trading::time_resampler{180, 60, offsets[p]}, averager,
+                                         min_equity};
+            recording_trader expect{min_equity+1};
+            mock_observer observer;
+            simulator(expect, observer);
+
+            BOOST_REQUIRE_EQUAL(observers[p].decided_count, observer.decided_count);
+            BOOST_REQUIRE_EQUAL(observers[p].finished_count, 1);
+            BOOST_REQUIRE_EQUAL(traders[p].updates.size(), expect.updates.size());
+
+            for (std::size_t i{0}; i<expect.updates.size(); i++) {
+                BOOST_REQUIRE_EQUAL(traders[p].updates[i].first, expect.updates[i].first);
+                BOOST_REQUIRE_EQUAL(traders[p].updates[i].second, expect.updates[i].second);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(minimum_equity_test)
+    {
+        amount_t min_equity{300};
+        trading::phase_simulator phases{phase_candles(), 180, 60, {0, 60}, trading::candle::ohlc4{}, min_equity};
+        std::vector<recording_trader> traders{recording_trader{min_equity+1}, recording_trader{min_equity}};
+        std::vector<mock_observer> observers(2);
+        phases(traders, observers);
+
+        BOOST_REQUIRE_EQUAL(observers[0].decided_count, phases.prices().size());
+        BOOST_REQUIRE_EQUAL(observers[1].decided_count, 0);
+        BOOST_REQUIRE_EQUAL(observers[1].finished_count, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(compact_test)
+    {
+        // runs of equal prices, split by the indicator updates of each phase
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<12; i++) {
+            price_t price = 100+static_cast<price_t>(i/4);
+            candles.emplace_back(trading::candle{i*60, price, price+2, price-2, price});
+        }
+        amount_t min_equity{300};
+        auto offsets = trading::phase_simulator::all_offsets(180, 60);
+        trading::phase_simulator expect{candles, 180, 60, offsets, trading::candle::ohlc4{}, min_equity};
+        trading::phase_simulator actual{candles, 180, 60, offsets, trading::candle::ohlc4{}, min_equity};
+        BOOST_REQUIRE(!actual.compacted());
+        BOOST_REQUIRE_EQUAL(actual.compression_ratio(), 1.0);
+
+        actual.compact();
+        BOOST_REQUIRE(actual.compacted());
+        BOOST_REQUIRE(actual.compression_ratio()>1.0);
+
+        for (std::size_t p{0}; p<offsets.size(); p++) {
+            const auto& run_ends = actual.run_ends(p);
+            BOOST_REQUIRE(expect.run_ends(p).empty());
+            BOOST_REQUIRE_EQUAL(run_ends.back(), candles.size());
+            for (auto end: actual.indicator_ends(p))
+                BOOST_REQUIRE(std::find(run_ends.begin(), run_ends.end(), end+1)!=run_ends.end());
+        }
+
+        std::vector<recording_trader> expect_traders(offsets.size(), recording_trader{min_equity+1});
+        std::vector<recording_trader> actual_traders(expect_traders);
+        std::vector<mock_observer> expect_observers(offsets.size()), actual_observers(offsets.size());
+        expect(expect_traders, expect_observers);
+        actual(actual_traders, actual_observers);
+
+        for (std::size_t p{0}; p<offsets.size(); p++) {
+            // a trader doing nothing decides once per run
+            BOOST_REQUIRE_EQUAL(actual_observers[p].decided_count, actual.run_ends(p).size());
+            BOOST_REQUIRE_EQUAL(actual_observers[p].finished_count, 1);
+            BOOST_REQUIRE_EQUAL(actual_traders[p].updates.size(), expect_traders[p].updates.size());
+
+            for (std::size_t i{0}; i<expect_traders[p].updates.size(); i++)
+                BOOST_REQUIRE_EQUAL(actual_traders[p].updates[i].second, expect_traders[p].updates[i].second);
+        }
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_PHASE_SIMULATOR_HPP
@@ -0,0 +1,86 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_RANDOM_ENGINE_HPP
+#define BACKTESTING_TEST_RANDOM_ENGINE_HPP
+
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <trading/random/engine.hpp>
+#include <trading/random/generators.hpp>
+
+BOOST_AUTO_TEST_SUITE(random_philox_engine_test)
+    using engine_t = trading::random::philox_engine;
+
+    std::vector<engine_t::result_type> draw(engine_t gen, std::size_t count)
+    {
+        std::vector<engine_t::result_type> values(count);
+        for (auto& value: values) value = gen();
+        return values;
+    }
+
+    BOOST_AUTO_TEST_CASE(known_answer_test)
+    {
+        // known answers of Philox4x32-10 from the Random123 library
+        using block_t = engine_t::block_type;
+        BOOST_REQUIRE(engine_t::block({0, 0, 0, 0}, {0, 0})==
+                (block_t{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+        BOOST_REQUIRE(engine_t::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff})==
+                (block_t{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+        BOOST_REQUIRE(engine_t::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0})==
+                (block_t{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+    }
+
+    BOOST_AUTO_TEST_CASE(stream_test)
+    {
+        engine_t gen{42};
+        BOOST_REQUIRE(draw(engine_t{42}, 100)==draw(gen, 100));
+        BOOST_REQUIRE(draw(gen.split(3), 100)==draw(engine_t{42}.split(3), 100));
+        BOOST_REQUIRE(draw(gen.split(1).split(2), 100)==draw(engine_t{42}.split(1).split(2), 100));
+
+        // the streams differ from each other and from other seeds
+        BOOST_REQUIRE(draw(engine_t{43}, 100)!=draw(gen, 100));
+        BOOST_REQUIRE(draw(gen.split(0), 100)!=draw(gen, 100));
+        BOOST_REQUIRE(draw(gen.split(0), 100)!=draw(gen.split(1), 100));
+        BOOST_REQUIRE(draw(gen.split(1).split(2), 100)!=draw(gen.split(2).split(1), 100));
+        BOOST_REQUIRE_EQUAL(gen.split(5).seed(), gen.seed());
+    }
+
+    BOOST_AUTO_TEST_CASE(discard_test)
+    {
+        for (std::size_t first{0}; first<6; first++)
+            for (std::size_t count{0}; count<13; count++) {
+                engine_t expect{7}, actual{7};
+                for (std::size_t i{0}; i<first; i++) {
+                    expect();
+                    actual();
+                }
+                for (std::size_t i{0}; i<count; i++) expect();
+                actual.discard(count);
+                BOOST_REQUIRE(draw(actual, 10)==draw(expect, 10));
+            }
+    }
+
+    BOOST_AUTO_TEST_CASE(size_test)
+    {
+        // copied with the components, unlike the state table of the Mersenne Twister
+        BOOST_REQUIRE_LE(sizeof(engine_t), 64);
+    }
+
+    BOOST_AUTO_TEST_CASE(reproducibility_test)
+    {
+        constexpr std::size_t n_levels{3};
+        auto levels = [](std::uint64_t seed) {
+            trading::random::levels_generator<n_levels> gen{10, trading::fraction_t{1, 10}, 1, engine_t{seed}};
+            std::vector<std::array<trading::fraction_t, n_levels>> values;
+            for (std::size_t i{0}; i<50; i++)
+                values.emplace_back(gen());
+            return values;
+        };
+        BOOST_REQUIRE(levels(11)==levels(11));
+        BOOST_REQUIRE(levels(11)!=levels(12));
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_RANDOM_ENGINE_HPP
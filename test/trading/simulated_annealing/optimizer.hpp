@@ -5,6 +5,9 @@
 #ifndef BACKTESTING_TEST_SIMULATED_ANNEALING_OPTIMIZER_HPP
 #define BACKTESTING_TEST_SIMULATED_ANNEALING_OPTIMIZER_HPP
 
+#include <tuple>
+#include <random>
+#include <algorithm>
 #include <boost/test/unit_test.hpp>
 #include <trading/random/generators.hpp>
 #include <trading/result.hpp>
@@ -147,6 +150,51 @@ BOOST_AUTO_TEST_SUITE(simulated_annealing_optimizer_test)
         double start_temp{5}, min_temp{10};
         BOOST_REQUIRE_THROW(optimizer_t(start_temp, min_temp), std::invalid_argument);
     }
+
+    BOOST_AUTO_TEST_CASE(speculation_exception_test)
+    {
+        BOOST_REQUIRE_THROW(optimizer_t(100, 1, 0), std::invalid_argument);
+    }
+
+    struct seeded_neighbor {
+        std::mt19937 gen{42};
+
+        int operator()(int origin)
+        {
+            return std::clamp(origin+std::uniform_int_distribution<int>{-5, 5}(gen), 1, 100);
+        }
+    };
+
+    BOOST_AUTO_TEST_CASE(speculation_test)
+    {
+        auto cooler = [](auto& optimizer) {
+            optimizer.current_temperature(optimizer.current_temperature()-1);
+        };
+        auto appraiser = [](const auto& current, const auto& candidate) {
+            return current.value-candidate.value;
+        };
+        auto constraints = [](const auto& state) { return true; };
+        auto equilibrium = trading::simulated_annealing::fixed_equilibrium{10};
+
+        auto optimize = [&](std::size_t speculation) {
+            auto optimizer = optimizer_t{100, 1, speculation, trading::random::engine{7}};
+            BOOST_REQUIRE_EQUAL(optimizer.speculation(), speculation);
+            auto counter = event_counter{};
+            state_t init{objective(50)};
+            trading::constructive_result result{init, [&](const auto& lhs, const auto& rhs) {
+                return lhs.value>rhs.value;
+            }};
+            optimizer(init.config, result, constraints, objective, cooler, seeded_neighbor{}, appraiser,
+                    equilibrium, counter);
+            return std::tuple{optimizer.current_state().config, result.get().config, counter.better_accepted_count,
+                              counter.worse_accepted_count};
+        };
+
+        // the chain is the same as without the speculation
+        auto expect = optimize(1);
+        for (std::size_t speculation: {2, 4, 7, 16})
+            BOOST_REQUIRE(optimize(speculation)==expect);
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_SIMULATED_ANNEALING_OPTIMIZER_HPP
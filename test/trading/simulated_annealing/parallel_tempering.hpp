@@ -0,0 +1,154 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_SIMULATED_ANNEALING_PARALLEL_TEMPERING_HPP
+#define BACKTESTING_TEST_SIMULATED_ANNEALING_PARALLEL_TEMPERING_HPP
+
+#include <atomic>
+#include <boost/test/unit_test.hpp>
+#include <trading/random/generators.hpp>
+#include <trading/result.hpp>
+#include <trading/termination.hpp>
+#include <trading/simulated_annealing/parallel_tempering.hpp>
+#include <trading/simulated_annealing/progress_collector.hpp>
+
+BOOST_AUTO_TEST_SUITE(simulated_annealing_parallel_tempering_test)
+    using config_t = int;
+    using state_t = trading::state<config_t>;
+    using optimizer_t = trading::simulated_annealing::parallel_tempering<state_t>;
+    auto objective = [](const auto& config) { return state_t{config, static_cast<double>(config)}; };
+    auto appraiser = [](const auto& current, const auto& candidate) { return current.value-candidate.value; };
+    auto make_neighbor = [](trading::random::engine gen) {
+        return trading::random::int_range_generator(1, 1'000, 1, 20, gen);
+    };
+
+    struct event_counter {
+        std::size_t started_count{0}, finished_count{0}, iteration_passed_count{0};
+        std::vector<std::size_t> better_accepted_counts, worse_accepted_counts, exchanged_counts;
+
+        template<class Optimizer>
+        void started(const Optimizer& optimizer)
+        {
+            BOOST_REQUIRE_EQUAL(started_count, 0);
+            started_count++;
+            better_accepted_counts.assign(optimizer.chain_count(), 0);
+            worse_accepted_counts.assign(optimizer.chain_count(), 0);
+            exchanged_counts.assign(optimizer.chain_count(), 0);
+        }
+
+        template<class Optimizer>
+        void better_accepted(const Optimizer&, std::size_t chain)
+        {
+            better_accepted_counts[chain]++;
+        }
+
+        template<class Optimizer>
+        void worse_accepted(const Optimizer&, std::size_t chain)
+        {
+            worse_accepted_counts[chain]++;
+        }
+
+        template<class Optimizer>
+        void exchanged(const Optimizer&, std::size_t chain)
+        {
+            exchanged_counts[chain]++;
+        }
+
+        template<class Optimizer>
+        void iteration_passed(const Optimizer&)
+        {
+            BOOST_REQUIRE_EQUAL(finished_count, 0);
+            iteration_passed_count++;
+        }
+
+        template<class Optimizer>
+        void finished(const Optimizer&)
+        {
+            BOOST_REQUIRE_EQUAL(finished_count, 0);
+            finished_count++;
+        }
+    };
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(optimizer_t({10}, 1), std::invalid_argument);
+        BOOST_REQUIRE_THROW(optimizer_t({0, 10}, 1), std::invalid_argument);
+        BOOST_REQUIRE_THROW(optimizer_t({10, 5}, 1), std::invalid_argument);
+        BOOST_REQUIRE_THROW(optimizer_t({10, 10}, 1), std::invalid_argument);
+        BOOST_REQUIRE_THROW(optimizer_t({1, 10}, 0), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        std::atomic<std::size_t> evaluated_count{0};
+        auto counted = [&](const config_t& config) {
+            evaluated_count++;
+            return objective(config);
+        };
+        trading::constructive_result result{objective(1), [](const auto& lhs, const auto& rhs) {
+            return lhs.value>rhs.value;
+        }};
+        auto optimizer = optimizer_t{{1, 4, 16, 64}, 25};
+        auto termination = trading::iteration_based_termination{40};
+        event_counter counter;
+        trading::simulated_annealing::progress_collector collector;
+        optimizer(1, result, [](const auto&) { return true; }, counted, make_neighbor, appraiser, termination,
+                counter, collector);
+
+        BOOST_REQUIRE_EQUAL(result.get().config, 1'000);
+        BOOST_REQUIRE_EQUAL(optimizer.best_state().config, 1'000);
+        BOOST_REQUIRE_EQUAL(evaluated_count, 1+4*25*40);
+        BOOST_REQUIRE_EQUAL(counter.started_count, 1);
+        BOOST_REQUIRE_EQUAL(counter.finished_count, 1);
+        BOOST_REQUIRE_EQUAL(counter.iteration_passed_count, termination.max_it());
+        BOOST_REQUIRE_EQUAL(collector.get().size(), 4*termination.max_it());
+        BOOST_REQUIRE_EQUAL(collector.get()[3].temperature, 64);
+
+        for (std::size_t c{0}; c<optimizer.chain_count(); c++) {
+            BOOST_REQUIRE(counter.better_accepted_counts[c]>0);
+            BOOST_REQUIRE_EQUAL(counter.exchanged_counts[c], optimizer.exchange_count(c));
+        }
+        BOOST_REQUIRE(counter.worse_accepted_counts.back()>counter.worse_accepted_counts.front());
+        BOOST_REQUIRE_EQUAL(optimizer.exchange_count(3), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(no_constrains_satisfied_test)
+    {
+        state_t init{objective(0)};
+        trading::constructive_result result{init, [](const auto& lhs, const auto& rhs) {
+            return lhs.value>rhs.value;
+        }};
+        auto optimizer = optimizer_t{{1, 10}, 10};
+        optimizer(0, result, [](const auto&) { return false; }, objective, make_neighbor, appraiser,
+                trading::iteration_based_termination{10});
+        BOOST_REQUIRE_EQUAL(result.get().value, init.value);
+    }
+
+    BOOST_AUTO_TEST_CASE(reproducibility_test)
+    {
+        auto run = [](std::uint64_t seed) {
+            trading::constructive_result result{objective(1), [](const auto& lhs, const auto& rhs) {
+                return lhs.value>rhs.value;
+            }};
+            auto optimizer = optimizer_t{{1, 4, 16, 64}, 5, trading::random::engine{seed}};
+            trading::simulated_annealing::progress_collector collector;
+            optimizer(1, result, [](const auto&) { return true; }, objective,
+                    [](trading::random::engine gen) { return trading::random::int_range_generator(1, 10'000, 1, 100, gen); },
+                    appraiser, trading::iteration_based_termination{20}, collector);
+
+            std::vector<double> values;
+            for (const auto& progress: collector.get())
+                values.emplace_back(progress.curr_state_value);
+            for (std::size_t c{0}; c<optimizer.chain_count(); c++)
+                values.emplace_back(static_cast<double>(optimizer.exchange_count(c)));
+            values.emplace_back(result.get().value);
+            return values;
+        };
+        auto values = run(42), repeated = run(42);
+        BOOST_REQUIRE_EQUAL_COLLECTIONS(values.begin(), values.end(), repeated.begin(), repeated.end());
+        BOOST_REQUIRE(values!=run(43));
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_SIMULATED_ANNEALING_PARALLEL_TEMPERING_HPP
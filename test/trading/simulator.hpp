@@ -5,11 +5,20 @@
 #ifndef BACKTESTING_TEST_SIMULATOR_HPP
 #define BACKTESTING_TEST_SIMULATOR_HPP
 
+#include <cmath>
 #include <boost/test/unit_test.hpp>
 #include <trading/simulator.hpp>
 #include <trading/resampler.hpp>
+#include <trading/time_resampler.hpp>
+#include <trading/candle_pyramid.hpp>
 #include <trading/data_point.hpp>
 #include <trading/action.hpp>
+#include <trading/sma.hpp>
+#include <trading/bazooka/indicator.hpp>
+#include <trading/bazooka/strategy.hpp>
+#include <trading/bazooka/manager.hpp>
+#include <trading/bazooka/trader.hpp>
+#include <trading/bazooka/statistics.hpp>
 #include "fixtures.hpp"
 
 BOOST_AUTO_TEST_SUITE(simulator_test)
@@ -148,6 +157,124 @@ BOOST_AUTO_TEST_SUITE(simulator_test)
         BOOST_REQUIRE_EQUAL(counter.indicators_updated_count, simulator.indicator_prices().size());
         BOOST_REQUIRE_EQUAL(counter.finished_count, 1);
     }
+
+    BOOST_AUTO_TEST_CASE(time_resampler_constructor_test)
+    {
+        // the candle opened at 120 is missing
+        std::vector<trading::candle> candles{
+                {0, 5'000, 15'000, 2'500, 10'000},
+                {60, 10'100, 12'000, 8'500, 11'000},
+                {180, 12'000, 20'000, 11'500, 18'000},
+                {240, 17'500, 20'300, 13'500, 16'400},
+                {300, 17'000, 25'000, 15'500, 23'400},
+        };
+        amount_t min_equity{300};
+        auto averager = trading::candle::ohlc4{};
+        trading::time_resampler resampler{120, 60};
+        trading::simulator simulator{candles, resampler, averager, min_equity};
+        BOOST_REQUIRE_EQUAL(simulator.resampling_period(), 2);
+        BOOST_REQUIRE_EQUAL(simulator.prices().size(), candles.size());
+
+        std::vector<trading::index_t> expect_ends{1, 2, 4};
+        BOOST_REQUIRE_EQUAL(simulator.indicator_ends().size(), expect_ends.size());
+        BOOST_REQUIRE_EQUAL(simulator.indicator_prices().size(), expect_ends.size());
+        for (std::size_t i{0}; i<expect_ends.size(); i++)
+            BOOST_REQUIRE_EQUAL(simulator.indicator_ends()[i], expect_ends[i]);
+        BOOST_REQUIRE_EQUAL(simulator.indicator_prices()[1], averager(candles[2]));
+
+        auto trader = mock_trader{false, trading::action::none, min_equity+1};
+        auto counter = event_counter{};
+        simulator(trader, counter);
+        BOOST_REQUIRE_EQUAL(counter.decided_count, candles.size());
+        BOOST_REQUIRE_EQUAL(counter.indicators_updated_count, expect_ends.size());
+    }
+
+    BOOST_AUTO_TEST_CASE(timeframe_constructor_test)
+    {
+        std::vector<trading::candle> candles{
+                {0, 5'000, 15'000, 2'500, 10'000},
+                {60, 10'100, 12'000, 8'500, 11'000},
+                {180, 12'000, 20'000, 11'500, 18'000},
+                {240, 17'500, 20'300, 13'500, 16'400},
+                {300, 17'000, 25'000, 15'500, 23'400},
+        };
+        amount_t min_equity{300};
+        auto averager = trading::candle::ohlc4{};
+        trading::candle_pyramid pyramid{candles, 1'000'000};
+        trading::simulator actual{candles, *pyramid(120), pyramid.candle_period(), averager, min_equity};
+        trading::simulator expect{candles, trading::time_resampler{120, 60}, averager, min_equity};
+
+        BOOST_REQUIRE_EQUAL(actual.resampling_period(), expect.resampling_period());
+        BOOST_REQUIRE_EQUAL(actual.indicator_ends().size(), expect.indicator_ends().size());
+        for (std::size_t i{0}; i<expect.indicator_ends().size(); i++) {
+            BOOST_REQUIRE_EQUAL(actual.indicator_ends()[i], expect.indicator_ends()[i]);
+            BOOST_REQUIRE_EQUAL(actual.indicator_prices()[i], expect.indicator_prices()[i]);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(compact_test)
+    {
+        std::vector<trading::candle> candles;
+        for (trading::price_t close: {10, 10, 10, 11, 11, 10, 10, 10})
+            candles.emplace_back(trading::candle{static_cast<std::time_t>(candles.size()*60), close, close, close, close});
+        amount_t min_equity{300};
+        trading::simulator simulator{candles, 2, trading::candle::ohlc4{}, min_equity};
+        BOOST_REQUIRE(!simulator.compacted());
+        BOOST_REQUIRE_EQUAL(simulator.compression_ratio(), 1.0);
+
+        // runs are split after the indicator updates at 1, 3, 5 and 7
+        simulator.compact();
+        std::vector<trading::index_t> expect_ends{2, 3, 4, 5, 6, 8};
+        BOOST_REQUIRE_EQUAL(simulator.run_ends().size(), expect_ends.size());
+        for (std::size_t i{0}; i<expect_ends.size(); i++)
+            BOOST_REQUIRE_EQUAL(simulator.run_ends()[i], expect_ends[i]);
+        BOOST_REQUIRE_CLOSE(simulator.compression_ratio(), 8.0/6.0, 1e-9);
+
+        auto trader = mock_trader{false, trading::action::none, min_equity+1};
+        auto counter = event_counter{};
+        simulator(trader, counter);
+        BOOST_REQUIRE_EQUAL(counter.decided_count, expect_ends.size());
+        BOOST_REQUIRE_EQUAL(counter.indicators_updated_count, simulator.indicator_prices().size());
+    }
+
+    BOOST_AUTO_TEST_CASE(compact_statistics_test)
+    {
+        // stepwise prices, so there are long runs of equal prices
+        std::vector<trading::candle> candles;
+        for (std::time_t i{0}; i<3'000; i++) {
+            auto close = static_cast<trading::price_t>(100+std::round(8*std::sin(i/40.0)+3*std::sin(i/7.0)));
+            candles.emplace_back(trading::candle{i*60, close, close, close, close});
+        }
+        std::array<trading::fraction_t, 3> levels{{{19, 20}, {18, 20}, {17, 20}}};
+        std::array<trading::fraction_t, 3> sizes{{{1, 3}, {1, 3}, {1, 3}}};
+        trading::bazooka::indicator indic{trading::sma{6}};
+        trading::bazooka::strategy strategy{indic, indic, levels};
+        trading::fraction_t fee{1, 100};
+        trading::market market{trading::wallet{10'000}, fee, fee};
+        trading::bazooka::manager manager{market, trading::order_sizer{sizes}};
+
+        for (amount_t min_equity: {0.0f, 9'900.0f}) {
+            trading::simulator expect_simulator{candles, 3, trading::candle::ohlc4{}, min_equity};
+            trading::simulator actual_simulator{expect_simulator};
+            actual_simulator.compact();
+            BOOST_REQUIRE(actual_simulator.compression_ratio()>1.0);
+
+            trading::bazooka::statistics<3>::collector expect, actual;
+            expect_simulator(trading::bazooka::trader{strategy, manager}, expect);
+            actual_simulator(trading::bazooka::trader{strategy, manager}, actual);
+            BOOST_REQUIRE(expect.get().total_open_orders()>0);
+            BOOST_REQUIRE_EQUAL(actual.get().total_open_orders(), expect.get().total_open_orders());
+            BOOST_REQUIRE_EQUAL(actual.get().total_close_all_orders(), expect.get().total_close_all_orders());
+            BOOST_REQUIRE_EQUAL(actual.get().final_balance(), expect.get().final_balance());
+            BOOST_REQUIRE_EQUAL(actual.get().min_equity(), expect.get().min_equity());
+            BOOST_REQUIRE_EQUAL(actual.get().max_equity(), expect.get().max_equity());
+            BOOST_REQUIRE_EQUAL(actual.get().max_equity_drawdown<trading::amount>(),
+                    expect.get().max_equity_drawdown<trading::amount>());
+            BOOST_REQUIRE_EQUAL(actual.get().max_equity_run_up<trading::amount>(),
+                    expect.get().max_equity_run_up<trading::amount>());
+            BOOST_REQUIRE(actual.get().open_order_counts()==expect.get().open_order_counts());
+        }
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_SIMULATOR_HPP
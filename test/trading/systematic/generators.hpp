@@ -9,6 +9,7 @@
 #include <array>
 #include <exception>
 #include <map>
+#include <set>
 #include <trading/systematic/generators.hpp>
 #include <trading/types.hpp>
 #include "../fixtures.hpp"
@@ -57,6 +58,20 @@ void test_levels_validity(Generator&& gen, Validator&& validate)
     }
 }
 
+// the values at the indices are the generated ones in the same order
+template<class Generator>
+void test_random_access(Generator&& gen)
+{
+    std::size_t index{0};
+    for (const auto& val: gen()) {
+        BOOST_REQUIRE(gen.at(index)==val);
+        BOOST_REQUIRE_EQUAL(gen.index_of(val), index);
+        index++;
+    }
+    BOOST_REQUIRE_EQUAL(gen.value_count(), index);
+    BOOST_REQUIRE_THROW(gen.at(index), std::out_of_range);
+}
+
 BOOST_AUTO_TEST_SUITE(systematic_levels_generator_test)
     BOOST_AUTO_TEST_CASE(constructor_exception_test)
     {
@@ -110,6 +125,56 @@ BOOST_AUTO_TEST_SUITE(systematic_levels_generator_test)
                 test_uniqueness(generator_type{unique_count, lower_bound});
             }
     }
+
+    BOOST_AUTO_TEST_CASE(unique_levels_test)
+    {
+        constexpr std::size_t n_levels{3};
+        trading::systematic::levels_generator<n_levels> generator{7, {1, 2}};
+        auto unique = generator.unique_levels();
+        BOOST_REQUIRE_EQUAL(unique.size(), 7);
+        std::set<std::pair<std::size_t, std::size_t>> used;
+
+        for (const auto& levels: generator())
+            for (const auto& level: levels) {
+                BOOST_REQUIRE(std::find_if(unique.begin(), unique.end(), [&](const auto& frac) {
+                    return frac.numerator()==level.numerator() && frac.denominator()==level.denominator();
+                })!=unique.end());
+                used.emplace(level.numerator(), level.denominator());
+            }
+        BOOST_REQUIRE_EQUAL(used.size(), unique.size());
+    }
+
+    BOOST_AUTO_TEST_CASE(random_access_test)
+    {
+        test_random_access(trading::systematic::levels_generator<1>{5});
+        test_random_access(trading::systematic::levels_generator<3>{3});
+        test_random_access(trading::systematic::levels_generator<3>{12, {15, 20}});
+        test_random_access(trading::systematic::levels_generator<4>{10, {1, 3}});
+        BOOST_REQUIRE_EQUAL(trading::systematic::levels_generator<3>{15}.value_count(), 455);
+    }
+
+    BOOST_AUTO_TEST_CASE(index_of_exception_test)
+    {
+        trading::systematic::levels_generator<3> gen{12, {15, 20}};
+        auto levels = gen.at(7);
+        BOOST_REQUIRE_NO_THROW(gen.index_of(levels));
+
+        auto ascending = levels;
+        std::swap(ascending[0], ascending[2]);
+        BOOST_REQUIRE_THROW(gen.index_of(ascending), std::invalid_argument);
+
+        auto repeated = levels;
+        repeated[1] = repeated[0];
+        BOOST_REQUIRE_THROW(gen.index_of(repeated), std::invalid_argument);
+
+        auto off_grid = levels;
+        off_grid[1] = trading::fraction_t{off_grid[1].numerator()+1, off_grid[1].denominator()};
+        BOOST_REQUIRE_THROW(gen.index_of(off_grid), std::invalid_argument);
+
+        auto other_denominator = levels;
+        other_denominator[2] = trading::fraction_t{levels[2].numerator(), levels[2].denominator()+1};
+        BOOST_REQUIRE_THROW(gen.index_of(other_denominator), std::invalid_argument);
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(systematic_sizes_generator_test)
@@ -169,6 +234,24 @@ BOOST_AUTO_TEST_SUITE(systematic_sizes_generator_test)
         for (const auto& unique_count: unique_counts)
             test_uniqueness(generator_type{unique_count});
     }
+
+    BOOST_AUTO_TEST_CASE(random_access_test)
+    {
+        test_random_access(trading::systematic::sizes_generator<2>{1});
+        test_random_access(trading::systematic::sizes_generator<3>{6});
+        test_random_access(trading::systematic::sizes_generator<4>{5});
+        test_random_access(trading::systematic::sizes_generator<5>{3});
+    }
+
+    BOOST_AUTO_TEST_CASE(index_of_exception_test)
+    {
+        trading::systematic::sizes_generator<3> gen{6};
+        BOOST_REQUIRE_NO_THROW(gen.index_of({{{1, 8}, {3, 8}, {4, 8}}}));
+        BOOST_REQUIRE_THROW(gen.index_of({{{1, 8}, {3, 8}, {3, 8}}}), std::invalid_argument);
+        BOOST_REQUIRE_THROW(gen.index_of({{{1, 8}, {7, 8}, {0, 8}}}), std::invalid_argument);
+        BOOST_REQUIRE_THROW(gen.index_of({{{1, 4}, {1, 4}, {2, 4}}}), std::invalid_argument);
+        BOOST_REQUIRE_THROW(gen.index_of({{{1, 8}, {3, 8}, {4, 9}}}), std::invalid_argument);
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(systematic_int_range_generator_test)
@@ -193,6 +276,31 @@ BOOST_AUTO_TEST_SUITE(systematic_int_range_generator_test)
             }
         }
     }
+
+    BOOST_AUTO_TEST_CASE(random_access_test)
+    {
+        std::size_t index{0};
+        trading::systematic::int_range_generator gen{3, 60, 3};
+        for (int val: gen()) {
+            BOOST_REQUIRE_EQUAL(gen.at(index), val);
+            BOOST_REQUIRE_EQUAL(gen.index_of(val), index);
+            index++;
+        }
+        BOOST_REQUIRE_EQUAL(gen.value_count(), index);
+        BOOST_REQUIRE_THROW(gen.at(index), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(index_of_exception_test)
+    {
+        trading::systematic::int_range_generator gen{3, 60, 3};
+        for (int val: {0, 4, 59, 61, 63, -3})
+            BOOST_REQUIRE_THROW(gen.index_of(val), std::invalid_argument);
+
+        trading::systematic::int_range_generator descending{60, 3, -3};
+        BOOST_REQUIRE_EQUAL(descending.index_of(57), 1);
+        for (int val: {0, 58, 63})
+            BOOST_REQUIRE_THROW(descending.index_of(val), std::invalid_argument);
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_SYSTEMATIC_GENERATORS_HPP
\ No newline at end of file
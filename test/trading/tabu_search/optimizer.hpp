@@ -7,6 +7,9 @@
 
 #include <boost/test/unit_test.hpp>
 #include <tuple>
+#include <cmath>
+#include <random>
+#include <algorithm>
 #include <trading/tabu_search/optimizer.hpp>
 #include <trading/tabu_search/memory.hpp>
 #include <trading/tabu_search/tenure.hpp>
@@ -104,6 +107,60 @@ BOOST_AUTO_TEST_SUITE(tabu_search_optimizer_test)
         BOOST_REQUIRE_EQUAL(counter.finished_count, 1);
         BOOST_REQUIRE_EQUAL(counter.iteration_passed_count, termination.max_it());
     }
+
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(optimizer_t(memory_t{1, 100, 1, 25}, 0), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(empty_neighborhood_test)
+    {
+        auto gen = trading::random::int_range_generator{1, 100, 1, 5};
+        trading::enumerative_result<state_t, maximization_criterion> result{1, maximization_criterion{}};
+        auto neighbor = [&](const config_t& origin) {
+            config_t next = gen(origin);
+            return std::make_tuple(next, next);
+        };
+        auto neighborhood = [](const optimizer_t&) -> std::size_t { return 0; };
+        auto aspiration = [](const auto&, const auto&) -> bool { return false; };
+        auto optimizer = optimizer_t{memory_t{gen.from(), gen.to(), gen.step(), 25}};
+        BOOST_REQUIRE_THROW(optimizer(gen(), result, [](const state_t&) { return true; }, objective, neighbor,
+                neighborhood, trading::iteration_based_termination(10), aspiration), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(thread_count_test)
+    {
+        // rugged objective, so the tabu list and the aspiration decide
+        auto rugged = [](const config_t& config) {
+            double value{0};
+            for (int i{1}; i<=1'000; i++)
+                value += std::sin(config*0.01*i)/i;
+            return state_t{config, value};
+        };
+
+        auto run = [&](std::size_t thread_count) {
+            std::mt19937 gen{7};
+            std::uniform_int_distribution<config_t> step{-5, 5};
+            config_t init{500};
+            trading::constructive_result result{rugged(init), maximization_criterion{}};
+            auto neighbor = [&](const config_t& origin) {
+                config_t next = std::clamp(origin+step(gen), 1, 1'000);
+                return std::make_tuple(next, next);
+            };
+            auto neighborhood = [](const optimizer_t&) -> std::size_t { return 64; };
+            auto aspiration = [&](const auto& candidate, const auto& optimizer) -> bool {
+                return result.compare(candidate, optimizer.best_state());
+            };
+            auto optimizer = optimizer_t{memory_t{1, 1'000, 1, 10}, thread_count};
+            optimizer(init, result, [](const state_t&) { return true; }, rugged, neighbor, neighborhood,
+                    trading::iteration_based_termination(50), aspiration);
+            return std::make_pair(optimizer.current_state().config, result.get().config);
+        };
+
+        auto expect = run(1);
+        for (std::size_t thread_count: {2, 4, 7})
+            BOOST_REQUIRE(run(thread_count)==expect);
+    }
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif //BACKTESTING_TEST_TABU_SEARCH_OPTIMIZER_HPP
@@ -0,0 +1,116 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_TICK_AGGREGATOR_HPP
+#define BACKTESTING_TEST_TICK_AGGREGATOR_HPP
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <trading/tick_aggregator.hpp>
+
+BOOST_AUTO_TEST_SUITE(tick_aggregator_test)
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(trading::tick_aggregator{0}, std::invalid_argument);
+        BOOST_REQUIRE_THROW(trading::tick_aggregator{-60}, std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(aggregate_test)
+    {
+        trading::tick_columns ticks;
+        ticks.emplace_back(0, 10, 1);
+        ticks.emplace_back(30, 12, 1);
+        ticks.emplace_back(59, 9, 1);
+        ticks.emplace_back(60, 11, 1);
+        ticks.emplace_back(200, 13, 1);   // empty bucket in between
+        ticks.emplace_back(201, 14, 1);
+
+        trading::tick_aggregator aggregator{60};
+        trading::candle_columns candles;
+        aggregator(ticks, candles);
+        BOOST_REQUIRE_EQUAL(candles.size(), 2);
+        aggregator.finish(candles);
+        BOOST_REQUIRE_EQUAL(candles.size(), 3);
+
+        std::vector<std::time_t> expect_opened{0, 60, 180};
+        std::vector<trading::price_t> expect_open{10, 11, 13}, expect_high{12, 11, 14};
+        std::vector<trading::price_t> expect_low{9, 11, 13}, expect_close{9, 11, 14};
+        BOOST_REQUIRE(candles.opened==expect_opened);
+        BOOST_REQUIRE(candles.open==expect_open);
+        BOOST_REQUIRE(candles.high==expect_high);
+        BOOST_REQUIRE(candles.low==expect_low);
+        BOOST_REQUIRE(candles.close==expect_close);
+
+        trading::tick_columns earlier;
+        earlier.emplace_back(100, 10, 1);
+        trading::tick_aggregator ordered{60};
+        ordered(ticks, candles);
+        BOOST_REQUIRE_THROW(ordered(earlier, candles), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(order_test)
+    {
+        // out of order within a bucket
+        trading::tick_columns unordered;
+        unordered.emplace_back(0, 10, 1);
+        unordered.emplace_back(30, 12, 1);
+        unordered.emplace_back(20, 11, 1);
+        unordered.emplace_back(90, 13, 1);
+
+        trading::tick_aggregator aggregator{60};
+        trading::candle_columns candles;
+        BOOST_REQUIRE_THROW(aggregator(unordered, candles), std::invalid_argument);
+        BOOST_REQUIRE_EQUAL(candles.size(), 0);
+
+        // before the last trade of the previous batch, in the same bucket
+        trading::tick_columns first, second;
+        first.emplace_back(0, 10, 1);
+        first.emplace_back(40, 12, 1);
+        second.emplace_back(30, 11, 1);
+        aggregator(first, candles);
+        BOOST_REQUIRE_THROW(aggregator(second, candles), std::invalid_argument);
+
+        // equal times are in order
+        trading::tick_columns equal;
+        equal.emplace_back(40, 11, 1);
+        equal.emplace_back(40, 9, 1);
+        aggregator(equal, candles);
+        aggregator.finish(candles);
+        BOOST_REQUIRE_EQUAL(candles.size(), 1);
+        BOOST_REQUIRE_EQUAL(candles.low[0], 9);
+        BOOST_REQUIRE_EQUAL(candles.close[0], 9);
+    }
+
+    BOOST_AUTO_TEST_CASE(batch_test)
+    {
+        // the batches split the buckets arbitrarily
+        trading::tick_columns all;
+        for (std::time_t i{0}; i<10'000; i++)
+            all.emplace_back(1'000+i*7, static_cast<trading::price_t>(100+10*std::sin(i/13.0)), 1);
+
+        trading::tick_aggregator whole{300, 30};
+        trading::candle_columns expect;
+        whole(all, expect);
+        whole.finish(expect);
+        BOOST_REQUIRE_EQUAL(expect.opened.front(), 930);
+
+        trading::tick_aggregator batched{300, 30};
+        trading::candle_columns actual;
+        for (std::size_t begin{0}, step{1}; begin<all.size(); begin += step, step = step*3%97+1) {
+            trading::tick_columns batch;
+            for (std::size_t i{begin}; i<std::min(all.size(), begin+step); i++)
+                batch.emplace_back(all.time[i], all.price[i], all.quantity[i]);
+            batched(batch, actual);
+        }
+        batched.finish(actual);
+
+        BOOST_REQUIRE(actual.opened==expect.opened);
+        BOOST_REQUIRE(actual.open==expect.open);
+        BOOST_REQUIRE(actual.high==expect.high);
+        BOOST_REQUIRE(actual.low==expect.low);
+        BOOST_REQUIRE(actual.close==expect.close);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_TICK_AGGREGATOR_HPP
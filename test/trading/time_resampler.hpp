@@ -0,0 +1,108 @@
+//
+// Created by Tomáš Petříček on 19.10.2026.
+//
+
+#ifndef BACKTESTING_TEST_TIME_RESAMPLER_HPP
+#define BACKTESTING_TEST_TIME_RESAMPLER_HPP
+
+#include <boost/test/unit_test.hpp>
+#include <trading/time_resampler.hpp>
+#include <trading/candle.hpp>
+
+BOOST_AUTO_TEST_SUITE(time_resampler_test)
+    BOOST_AUTO_TEST_CASE(constructor_exception_test)
+    {
+        BOOST_REQUIRE_THROW(trading::time_resampler(120, 0), std::invalid_argument);
+        BOOST_REQUIRE_THROW(trading::time_resampler(30, 60), std::invalid_argument);
+        BOOST_REQUIRE_THROW(trading::time_resampler(90, 60), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(bucket_opened_test)
+    {
+        trading::time_resampler resampler{120, 60};
+        BOOST_REQUIRE_EQUAL(resampler.bucket_opened(0), 0);
+        BOOST_REQUIRE_EQUAL(resampler.bucket_opened(60), 0);
+        BOOST_REQUIRE_EQUAL(resampler.bucket_opened(120), 120);
+        BOOST_REQUIRE_EQUAL(resampler.bucket_opened(-60), -120);
+
+        trading::time_resampler shifted{120, 60, 60};
+        BOOST_REQUIRE_EQUAL(shifted.bucket_opened(0), -60);
+        BOOST_REQUIRE_EQUAL(shifted.bucket_opened(60), 60);
+        BOOST_REQUIRE_EQUAL(shifted.bucket_opened(120), 60);
+    }
+
+    BOOST_AUTO_TEST_CASE(usage_test)
+    {
+        std::vector<trading::candle> samples{
+                {0, 5'000, 15'000, 2'500, 10'000},
+                {60, 10'100, 12'000, 8'500, 11'000},
+                {120, 10'900, 17'000, 9'900, 13'000},
+                {180, 12'000, 20'000, 11'500, 18'000},
+                {240, 17'500, 20'300, 13'500, 16'400},
+                {300, 17'000, 25'000, 15'500, 23'400},
+        };
+        std::vector<trading::candle> expect{
+                {0, 5'000, 15'000, 2'500, 11'000},
+                {120, 10'900, 20'000, 9'900, 18'000},
+                {240, 17'500, 25'000, 13'500, 23'400},
+        };
+
+        trading::time_resampler resampler{120, 60};
+        auto actual = resampler(samples);
+        BOOST_REQUIRE_EQUAL(actual.size(), expect.size());
+
+        for (std::size_t i{0}; i<actual.size(); i++) {
+            BOOST_REQUIRE_EQUAL(actual[i].value, expect[i]);
+            BOOST_REQUIRE_EQUAL(actual[i].last, 2*i+1);
+            BOOST_REQUIRE(resampler.complete(actual[i]));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(gap_test)
+    {
+        // the candle opened at 120 is missing
+        std::vector<trading::candle> samples{
+                {0, 5'000, 15'000, 2'500, 10'000},
+                {60, 10'100, 12'000, 8'500, 11'000},
+                {180, 12'000, 20'000, 11'500, 18'000},
+                {240, 17'500, 20'300, 13'500, 16'400},
+                {300, 17'000, 25'000, 15'500, 23'400},
+                {360, 23'000, 24'000, 22'000, 23'500},
+        };
+
+        trading::time_resampler resampler{120, 60};
+        auto actual = resampler(samples);
+        BOOST_REQUIRE_EQUAL(actual.size(), 3);
+        BOOST_REQUIRE_EQUAL(actual[1].value, trading::candle(120, 12'000, 20'000, 11'500, 18'000));
+        BOOST_REQUIRE_EQUAL(actual[1].last, 2);
+        BOOST_REQUIRE_EQUAL(actual[1].count, 1);
+        BOOST_REQUIRE(!resampler.complete(actual[1]));
+
+        // the following bucket is not shifted by the gap
+        BOOST_REQUIRE_EQUAL(actual[2].value, trading::candle(240, 17'500, 25'000, 13'500, 23'400));
+        BOOST_REQUIRE_EQUAL(actual[2].last, 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(offset_test)
+    {
+        std::vector<trading::candle> samples{
+                {0, 5'000, 15'000, 2'500, 10'000},
+                {60, 10'100, 12'000, 8'500, 11'000},
+                {120, 10'900, 17'000, 9'900, 13'000},
+                {180, 12'000, 20'000, 11'500, 18'000},
+        };
+
+        // the first bucket opened at -60 holds only the first candle, it is closed by the next bucket
+        // but not complete, the last bucket opened at 180 is left out as it is not complete yet
+        trading::time_resampler resampler{120, 60, 60};
+        auto actual = resampler(samples);
+        BOOST_REQUIRE_EQUAL(actual.size(), 2);
+        BOOST_REQUIRE_EQUAL(actual[0].last, 0);
+        BOOST_REQUIRE_EQUAL(actual[0].count, 1);
+        BOOST_REQUIRE(!resampler.complete(actual[0]));
+        BOOST_REQUIRE_EQUAL(actual[1].value, trading::candle(60, 10'100, 17'000, 8'500, 13'000));
+        BOOST_REQUIRE_EQUAL(actual[1].last, 2);
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif //BACKTESTING_TEST_TIME_RESAMPLER_HPP